@@ -0,0 +1,76 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/flags.cmake"
+  "/root/repo/src/kernel/elk_conv_binder.hxx"
+  "/root/repo/src/kernel/elk_conv_gen.sh"
+  "/root/repo/src/kernel/elk_gemm_binder.hxx"
+  "/root/repo/src/kernel/elk_gemm_gen.sh"
+  "/root/repo/src/kernel/elk_u8s8_conv_binder.hxx"
+  "/root/repo/src/kernel/elk_u8s8_conv_gen.sh"
+  "/root/repo/src/kernel/elk_u8s8_depthwise_conv_binder.hxx"
+  "/root/repo/src/kernel/elk_u8s8_depthwise_conv_gen.sh"
+  "/root/repo/src/kernel/elk_u8s8_gemm_binder.hxx"
+  "/root/repo/src/kernel/elk_u8s8_gemm_gen.sh"
+  "/root/repo/src/kernel/elk_vmg_conv_binder.hxx"
+  "/root/repo/src/kernel/elk_vmg_conv_gen.sh"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "kgen/elk_gemm_gen.sh"
+  "kgen/elk_u8s8_gemm_gen.sh"
+  "kgen/elk_conv_gen.sh"
+  "kgen/elk_vmg_conv_gen.sh"
+  "kgen/elk_u8s8_conv_gen.sh"
+  "kgen/elk_u8s8_depthwise_conv_gen.sh"
+  "kgen/elk_gemm_binder.hxx"
+  "kgen/elk_u8s8_gemm_binder.hxx"
+  "kgen/elk_conv_binder.hxx"
+  "kgen/elk_u8s8_conv_binder.hxx"
+  "kgen/elk_vmg_conv_binder.hxx"
+  "kgen/elk_u8s8_depthwise_conv_binder.hxx"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/el.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,172 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_16_1_ISA_AVX512_1_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_1_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_16_1_ISA_AVX512_1_GKF_EBD.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_1_GKF_EBD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_1_GKF_EBD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_16_1_ISA_AVX512_1_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_1_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_16_1_ISA_AVX512_2_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_2_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_16_1_ISA_AVX512_2_GKF_EBD.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_2_GKF_EBD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_2_GKF_EBD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_16_1_ISA_AVX512_2_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_2_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_16_1_ISA_AVX512_S2_LLP_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_16_1_ISA_AVX512_S2_LLP_GKF_EBD.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_S2_LLP_GKF_EBD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_S2_LLP_GKF_EBD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_16_1_ISA_AVX512_S2_LLP_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_EBD.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_EBD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_EBD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_2_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_2_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_2_GKF_EBD.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_2_GKF_EBD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_2_GKF_EBD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_2_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_2_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_S2_LLP_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_S2_LLP_GKF_EBD.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_S2_LLP_GKF_EBD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_S2_LLP_GKF_EBD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_S2_LLP_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_CCC.cpp" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_CCC.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_CCD.cpp" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_CCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_CCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_gemm_FP32_16_1_ISA_AVX512_2_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_2_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_gemm_FP32_16_1_ISA_AVX512_2_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_2_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_gemm_FP32_F16iwo_16_1_ISA_AVX512_1_GKF_CCC.cpp" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16iwo_16_1_ISA_AVX512_1_GKF_CCC.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16iwo_16_1_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_CCC.cpp" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_CCC.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_CCD.cpp" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_CCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_CCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_2_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_2_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_2_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_2_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FBD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FBD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FBD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FBF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FBF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FBF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FBD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FBD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FBD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FBF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FBF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FBF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_DCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_DCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_DCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FBD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FBD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FBD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FBF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FBF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FBF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FBD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FBD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FBD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FBF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FBF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FBF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FBD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FBD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FBD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FBF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FBF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FBF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FBD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FBD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FBD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FBF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FBF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FBF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FBD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FBD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FBD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FBF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FBF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FBF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_depthwise_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_depthwise_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_depthwise_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_depthwise_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_depthwise_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_depthwise_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_depthwise_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_depthwise_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_depthwise_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_depthwise_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_depthwise_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_depthwise_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F16o_float_16_4_ISA_AVX512_1_GKF_CCC.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F16o_float_16_4_ISA_AVX512_1_GKF_CCC.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F16o_float_16_4_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F16o_int8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F16o_int8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F16o_int8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F16o_uint8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F16o_uint8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F16o_uint8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_CCC.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_CCC.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_vmg_conv_FP32_16_1_ISA_AVX512_1_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_vmg_conv_FP32_16_1_ISA_AVX512_1_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_vmg_conv_FP32_16_1_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_vmg_conv_FP32_16_1_ISA_AVX512_1_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_vmg_conv_FP32_16_1_ISA_AVX512_1_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_vmg_conv_FP32_16_1_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_vmg_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_DCD.cpp" "CMakeFiles/el.dir/kgen/elk_vmg_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_DCD.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_vmg_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "/root/repo/_vnni_build/kgen/elk_vmg_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_FCF.cpp" "CMakeFiles/el.dir/kgen/elk_vmg_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_FCF.cpp.o" "gcc" "CMakeFiles/el.dir/kgen/elk_vmg_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "/root/repo/src/common/el_allocator.cpp" "CMakeFiles/el.dir/src/common/el_allocator.cpp.o" "gcc" "CMakeFiles/el.dir/src/common/el_allocator.cpp.o.d"
+  "/root/repo/src/common/el_log.cpp" "CMakeFiles/el.dir/src/common/el_log.cpp.o" "gcc" "CMakeFiles/el.dir/src/common/el_log.cpp.o.d"
+  "/root/repo/src/common/el_numa.cpp" "CMakeFiles/el.dir/src/common/el_numa.cpp.o" "gcc" "CMakeFiles/el.dir/src/common/el_numa.cpp.o.d"
+  "/root/repo/src/common/el_thread_pool.cpp" "CMakeFiles/el.dir/src/common/el_thread_pool.cpp.o" "gcc" "CMakeFiles/el.dir/src/common/el_thread_pool.cpp.o.d"
+  "/root/repo/src/el_init.cpp" "CMakeFiles/el.dir/src/el_init.cpp.o" "gcc" "CMakeFiles/el.dir/src/el_init.cpp.o.d"
+  "/root/repo/src/eld_conv.cpp" "CMakeFiles/el.dir/src/eld_conv.cpp.o" "gcc" "CMakeFiles/el.dir/src/eld_conv.cpp.o.d"
+  "/root/repo/src/eld_conv_arena.cpp" "CMakeFiles/el.dir/src/eld_conv_arena.cpp.o" "gcc" "CMakeFiles/el.dir/src/eld_conv_arena.cpp.o.d"
+  "/root/repo/src/eld_conv_chain.cpp" "CMakeFiles/el.dir/src/eld_conv_chain.cpp.o" "gcc" "CMakeFiles/el.dir/src/eld_conv_chain.cpp.o.d"
+  "/root/repo/src/elx_conv.cpp" "CMakeFiles/el.dir/src/elx_conv.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_conv.cpp.o.d"
+  "/root/repo/src/elx_conv_cost.cpp" "CMakeFiles/el.dir/src/elx_conv_cost.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_conv_cost.cpp.o.d"
+  "/root/repo/src/elx_conv_direct.cpp" "CMakeFiles/el.dir/src/elx_conv_direct.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_conv_direct.cpp.o.d"
+  "/root/repo/src/elx_conv_direct_1x1.cpp" "CMakeFiles/el.dir/src/elx_conv_direct_1x1.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_conv_direct_1x1.cpp.o.d"
+  "/root/repo/src/elx_conv_direct_vmg.cpp" "CMakeFiles/el.dir/src/elx_conv_direct_vmg.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_conv_direct_vmg.cpp.o.d"
+  "/root/repo/src/elx_conv_polyphase.cpp" "CMakeFiles/el.dir/src/elx_conv_polyphase.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_conv_polyphase.cpp.o.d"
+  "/root/repo/src/elx_conv_tuner.cpp" "CMakeFiles/el.dir/src/elx_conv_tuner.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_conv_tuner.cpp.o.d"
+  "/root/repo/src/elx_conv_tuning_cache.cpp" "CMakeFiles/el.dir/src/elx_conv_tuning_cache.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_conv_tuning_cache.cpp.o.d"
+  "/root/repo/src/elx_conv_wino.cpp" "CMakeFiles/el.dir/src/elx_conv_wino.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_conv_wino.cpp.o.d"
+  "/root/repo/src/elx_conv_wino_calib.cpp" "CMakeFiles/el.dir/src/elx_conv_wino_calib.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_conv_wino_calib.cpp.o.d"
+  "/root/repo/src/elx_conv_wino_gemm.cpp" "CMakeFiles/el.dir/src/elx_conv_wino_gemm.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_conv_wino_gemm.cpp.o.d"
+  "/root/repo/src/elx_conv_wino_trans_input.cpp" "CMakeFiles/el.dir/src/elx_conv_wino_trans_input.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_conv_wino_trans_input.cpp.o.d"
+  "/root/repo/src/elx_conv_wino_trans_output.cpp" "CMakeFiles/el.dir/src/elx_conv_wino_trans_output.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_conv_wino_trans_output.cpp.o.d"
+  "/root/repo/src/elx_conv_wino_trans_weights.cpp" "CMakeFiles/el.dir/src/elx_conv_wino_trans_weights.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_conv_wino_trans_weights.cpp.o.d"
+  "/root/repo/src/elx_deconv_direct.cpp" "CMakeFiles/el.dir/src/elx_deconv_direct.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_deconv_direct.cpp.o.d"
+  "/root/repo/src/elx_int8_conv_direct.cpp" "CMakeFiles/el.dir/src/elx_int8_conv_direct.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_int8_conv_direct.cpp.o.d"
+  "/root/repo/src/elx_int8_conv_direct_1x1.cpp" "CMakeFiles/el.dir/src/elx_int8_conv_direct_1x1.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_int8_conv_direct_1x1.cpp.o.d"
+  "/root/repo/src/elx_int8_conv_direct_depthwise.cpp" "CMakeFiles/el.dir/src/elx_int8_conv_direct_depthwise.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_int8_conv_direct_depthwise.cpp.o.d"
+  "/root/repo/src/elx_int8_conv_wino.cpp" "CMakeFiles/el.dir/src/elx_int8_conv_wino.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_int8_conv_wino.cpp.o.d"
+  "/root/repo/src/elx_int8_conv_wino_gemm.cpp" "CMakeFiles/el.dir/src/elx_int8_conv_wino_gemm.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_int8_conv_wino_gemm.cpp.o.d"
+  "/root/repo/src/elx_post_ops.cpp" "CMakeFiles/el.dir/src/elx_post_ops.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_post_ops.cpp.o.d"
+  "/root/repo/src/elx_reorder.cpp" "CMakeFiles/el.dir/src/elx_reorder.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_reorder.cpp.o.d"
+  "/root/repo/src/elx_stream.cpp" "CMakeFiles/el.dir/src/elx_stream.cpp.o" "gcc" "CMakeFiles/el.dir/src/elx_stream.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,317 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_1_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_1_GKF_EBD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_1_GKF_EBD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_1_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_2_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_2_GKF_EBD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_2_GKF_EBD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_2_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_S2_LLP_GKF_EBD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_S2_LLP_GKF_EBD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_16_1_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_EBD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_EBD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_2_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_2_GKF_EBD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_2_GKF_EBD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_2_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_S2_LLP_GKF_EBD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_S2_LLP_GKF_EBD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_conv_FP32_F16w_16_1_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_CCC.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_CCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_CCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_2_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_2_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_16_1_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16iwo_16_1_ISA_AVX512_1_GKF_CCC.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16iwo_16_1_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_CCC.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_CCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_CCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_2_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_2_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_gemm_FP32_F16w_16_1_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FBD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FBD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FBF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FBF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FBD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FBD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FBF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FBF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_DCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_DCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FBD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FBD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FBF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FBF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_float_16_4_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FBD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FBD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FBF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FBF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FBD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FBD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FBF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FBF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_int8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FBD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FBD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FBF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FBF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FBD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FBD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FBF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FBF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_DCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FBF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_S2_LLP_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_depthwise_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_depthwise_conv_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_depthwise_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_depthwise_conv_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_depthwise_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_depthwise_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_depthwise_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_depthwise_conv_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F16o_float_16_4_ISA_AVX512_1_GKF_CCC.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F16o_float_16_4_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F16o_int8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F16o_int8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F16o_uint8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F16o_uint8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_CCC.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_DCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_DCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_float_16_4_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_int8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_CCC.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_DCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_u8s8_gemm_INT8_F32_uint8_t_16_4_ISA_AVX512_2_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_vmg_conv_FP32_16_1_ISA_AVX512_1_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_vmg_conv_FP32_16_1_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_vmg_conv_FP32_16_1_ISA_AVX512_1_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_vmg_conv_FP32_16_1_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_vmg_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_DCD.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_vmg_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_DCD.cpp.o.d"
+  "CMakeFiles/el.dir/kgen/elk_vmg_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_FCF.cpp.o"
+  "CMakeFiles/el.dir/kgen/elk_vmg_conv_FP32_F16w_16_1_ISA_AVX512_1_GKF_FCF.cpp.o.d"
+  "CMakeFiles/el.dir/src/common/el_allocator.cpp.o"
+  "CMakeFiles/el.dir/src/common/el_allocator.cpp.o.d"
+  "CMakeFiles/el.dir/src/common/el_log.cpp.o"
+  "CMakeFiles/el.dir/src/common/el_log.cpp.o.d"
+  "CMakeFiles/el.dir/src/common/el_numa.cpp.o"
+  "CMakeFiles/el.dir/src/common/el_numa.cpp.o.d"
+  "CMakeFiles/el.dir/src/common/el_thread_pool.cpp.o"
+  "CMakeFiles/el.dir/src/common/el_thread_pool.cpp.o.d"
+  "CMakeFiles/el.dir/src/el_init.cpp.o"
+  "CMakeFiles/el.dir/src/el_init.cpp.o.d"
+  "CMakeFiles/el.dir/src/eld_conv.cpp.o"
+  "CMakeFiles/el.dir/src/eld_conv.cpp.o.d"
+  "CMakeFiles/el.dir/src/eld_conv_arena.cpp.o"
+  "CMakeFiles/el.dir/src/eld_conv_arena.cpp.o.d"
+  "CMakeFiles/el.dir/src/eld_conv_chain.cpp.o"
+  "CMakeFiles/el.dir/src/eld_conv_chain.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_conv.cpp.o"
+  "CMakeFiles/el.dir/src/elx_conv.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_conv_cost.cpp.o"
+  "CMakeFiles/el.dir/src/elx_conv_cost.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_conv_direct.cpp.o"
+  "CMakeFiles/el.dir/src/elx_conv_direct.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_conv_direct_1x1.cpp.o"
+  "CMakeFiles/el.dir/src/elx_conv_direct_1x1.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_conv_direct_vmg.cpp.o"
+  "CMakeFiles/el.dir/src/elx_conv_direct_vmg.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_conv_polyphase.cpp.o"
+  "CMakeFiles/el.dir/src/elx_conv_polyphase.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_conv_tuner.cpp.o"
+  "CMakeFiles/el.dir/src/elx_conv_tuner.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_conv_tuning_cache.cpp.o"
+  "CMakeFiles/el.dir/src/elx_conv_tuning_cache.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_conv_wino.cpp.o"
+  "CMakeFiles/el.dir/src/elx_conv_wino.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_conv_wino_calib.cpp.o"
+  "CMakeFiles/el.dir/src/elx_conv_wino_calib.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_conv_wino_gemm.cpp.o"
+  "CMakeFiles/el.dir/src/elx_conv_wino_gemm.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_conv_wino_trans_input.cpp.o"
+  "CMakeFiles/el.dir/src/elx_conv_wino_trans_input.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_conv_wino_trans_output.cpp.o"
+  "CMakeFiles/el.dir/src/elx_conv_wino_trans_output.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_conv_wino_trans_weights.cpp.o"
+  "CMakeFiles/el.dir/src/elx_conv_wino_trans_weights.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_deconv_direct.cpp.o"
+  "CMakeFiles/el.dir/src/elx_deconv_direct.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_int8_conv_direct.cpp.o"
+  "CMakeFiles/el.dir/src/elx_int8_conv_direct.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_int8_conv_direct_1x1.cpp.o"
+  "CMakeFiles/el.dir/src/elx_int8_conv_direct_1x1.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_int8_conv_direct_depthwise.cpp.o"
+  "CMakeFiles/el.dir/src/elx_int8_conv_direct_depthwise.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_int8_conv_wino.cpp.o"
+  "CMakeFiles/el.dir/src/elx_int8_conv_wino.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_int8_conv_wino_gemm.cpp.o"
+  "CMakeFiles/el.dir/src/elx_int8_conv_wino_gemm.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_post_ops.cpp.o"
+  "CMakeFiles/el.dir/src/elx_post_ops.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_reorder.cpp.o"
+  "CMakeFiles/el.dir/src/elx_reorder.cpp.o.d"
+  "CMakeFiles/el.dir/src/elx_stream.cpp.o"
+  "CMakeFiles/el.dir/src/elx_stream.cpp.o.d"
+  "libel.pdb"
+  "libel.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/el.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,51 @@
+// _generated_kernel_file_
+//
+#include "/root/repo/_vnni_build/kgen/elk_u8s8_depthwise_conv_binder.hxx"
+
+using namespace euler;
+
+namespace euler {
+
+#undef E
+#define E(O, T, K) \
+  u8s8_depthwise_conv_kernel_binder::conv_ker_cls<conv_impl::INT8_F32, \
+      uint8_t, 16, 4, ISA_AVX512, 1, GKF_DCD, O, T, K>::conv
+  u8s8_depthwise_conv_kernel_binder::kconv<conv_impl::INT8_F32, uint8_t>
+      *u8s8_depthwise_conv_kernel_binder::kconv_INT8_F32_uint8_t_16_4_ISA_AVX512_1_GKF_DCD[1][32][1] =
+  { // 8
+    { // 32
+      { E(1, 1,  3) },
+      { E(1, 2,  3) },
+      { E(1, 3,  3) },
+      { E(1, 4,  3) },
+      { E(1, 5,  3) },
+      { E(1, 6,  3) },
+      { E(1, 7,  3) },
+      { E(1, 8,  3) },
+      { E(1, 9,  3) },
+      { E(1, 10, 3) },
+      { E(1, 11, 3) },
+      { E(1, 12, 3) },
+      { E(1, 13, 3) },
+      { E(1, 14, 3) },
+      { E(1, 15, 3) },
+      { E(1, 16, 3) },
+      { E(1, 17, 3) },
+      { E(1, 18, 3) },
+      { E(1, 19, 3) },
+      { E(1, 20, 3) },
+      { E(1, 21, 3) },
+      { E(1, 22, 3) },
+      { E(1, 23, 3) },
+      { E(1, 24, 3) },
+      { E(1, 25, 3) },
+      { E(1, 26, 3) },
+      { E(1, 27, 3) },
+      { E(1, 28, 3) },
+      { E(1, 29, 3) },
+      { E(1, 30, 3) },
+      { E(1, 31, 3) },
+    },
+  };
+
+} // namespace
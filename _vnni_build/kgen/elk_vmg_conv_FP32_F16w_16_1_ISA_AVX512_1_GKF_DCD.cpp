@@ -0,0 +1,58 @@
+// _generated_kernel_file_
+//
+#include "/root/repo/_vnni_build/kgen/elk_vmg_conv_binder.hxx"
+
+using namespace euler;
+
+namespace euler {
+
+#undef E
+#define E(O, T, K) \
+  { \
+    vmg_conv_kernel_binder::conv_ker_cls<conv_impl::FP32_F16w, 16, 1, ISA_AVX512, 1, GKF_DCD, O, T, K, 1>::conv, \
+    vmg_conv_kernel_binder::conv_ker_cls<conv_impl::FP32_F16w, 16, 1, ISA_AVX512, 1, GKF_DCD, O, T, K, 2>::conv, \
+    vmg_conv_kernel_binder::conv_ker_cls<conv_impl::FP32_F16w, 16, 1, ISA_AVX512, 1, GKF_DCD, O, T, K, 4>::conv, \
+    vmg_conv_kernel_binder::conv_ker_cls<conv_impl::FP32_F16w, 16, 1, ISA_AVX512, 1, GKF_DCD, O, T, K, 8>::conv, \
+    vmg_conv_kernel_binder::conv_ker_cls<conv_impl::FP32_F16w, 16, 1, ISA_AVX512, 1, GKF_DCD, O, T, K, 16>::conv \
+  }
+  vmg_conv_kernel_binder::kconv<conv_impl::FP32_F16w>
+      *vmg_conv_kernel_binder::kconv_FP32_F16w_16_1_ISA_AVX512_1_GKF_DCD[1][32][3][5] =
+  { // 1
+    { // 32
+      { E(1, 1,  3), /* E(1, 1,  5), E(1, 1,  7) */ },
+      { E(1, 2,  3), /* E(1, 2,  5), E(1, 2,  7) */ },
+      { E(1, 3,  3), /* E(1, 3,  5), E(1, 3,  7) */ },
+      { E(1, 4,  3), /* E(1, 4,  5), E(1, 4,  7) */ },
+      { E(1, 5,  3), /* E(1, 5,  5), E(1, 5,  7) */ },
+      { E(1, 6,  3), /* E(1, 6,  5), E(1, 6,  7) */ },
+      { E(1, 7,  3), /* E(1, 7,  5), E(1, 7,  7) */ },
+      { E(1, 8,  3), /* E(1, 8,  5), E(1, 8,  7) */ },
+      { E(1, 9,  3), /* E(1, 9,  5), E(1, 9,  7) */ },
+      { E(1, 10, 3), /* E(1, 10, 5), E(1, 10, 7) */ },
+      { E(1, 11, 3), /* E(1, 11, 5), E(1, 11, 7) */ },
+      { E(1, 12, 3), /* E(1, 12, 5), E(1, 12, 7) */ },
+      { E(1, 13, 3), /* E(1, 13, 5), E(1, 13, 7) */ },
+      { E(1, 14, 3), /* E(1, 14, 5), E(1, 14, 7) */ },
+#if 0
+      { E(1, 15, 3), /* E(1, 15, 5), E(1, 15, 7) */ },
+      { E(1, 16, 3), /* E(1, 16, 5), E(1, 16, 7) */ },
+      { E(1, 17, 3), /* E(1, 17, 5), E(1, 17, 7) */ },
+      { E(1, 18, 3), /* E(1, 18, 5), E(1, 18, 7) */ },
+      { E(1, 19, 3), /* E(1, 19, 5), E(1, 19, 7) */ },
+      { E(1, 20, 3), /* E(1, 20, 5), E(1, 20, 7) */ },
+      { E(1, 21, 3), /* E(1, 21, 5), E(1, 21, 7) */ },
+      { E(1, 22, 3), /* E(1, 22, 5), E(1, 22, 7) */ },
+      { E(1, 23, 3), /* E(1, 23, 5), E(1, 23, 7) */ },
+      { E(1, 24, 3), /* E(1, 24, 5), E(1, 24, 7) */ },
+      { E(1, 25, 3), /* E(1, 25, 5), E(1, 25, 7) */ },
+      { E(1, 26, 3), /* E(1, 26, 5), E(1, 26, 7) */ },
+      { E(1, 27, 3), /* E(1, 27, 5), E(1, 27, 7) */ },
+      { E(1, 28, 3), /* E(1, 28, 5), E(1, 28, 7) */ },
+      { E(1, 29, 3), /* E(1, 29, 5), E(1, 29, 7) */ },
+      { E(1, 30, 3), /* E(1, 30, 5), E(1, 30, 7) */ },
+      { E(1, 31, 3), /* E(1, 31, 5), E(1, 31, 7) */ },
+#endif
+    },
+  };
+
+} // namespace
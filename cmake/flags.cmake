@@ -3,7 +3,12 @@ if (__flags_included)
 endif()
 
 set(__basic_flags "-Wall -Wextra -Wshadow")
-list(APPEND __basic_flags "-fopenmp")
+if(MT_RUNTIME STREQUAL "native")
+  # omp simd only, no OpenMP runtime
+  list(APPEND __basic_flags "-fopenmp-simd")
+else()
+  list(APPEND __basic_flags "-fopenmp")
+endif()
 list(APPEND __basic_flags "-Wno-sign-compare")
 list(APPEND __basic_flags "-Wno-uninitialized")
 list(APPEND __basic_flags "-Wno-unused-variable")
@@ -44,8 +49,10 @@ if(MT_RUNTIME STREQUAL "omp")
   list(APPEND __opt_flags "-DMT_RUNTIME=MT_RUNTIME_OMP")
 elseif(MT_RUNTIME STREQUAL "tbb")
   list(APPEND __opt_flags "-DMT_RUNTIME=MT_RUNTIME_TBB")
+elseif(MT_RUNTIME STREQUAL "native")
+  list(APPEND __opt_flags "-DMT_RUNTIME=MT_RUNTIME_NATIVE")
 else()
-  MESSAGE(FATAL_ERROR "MT_RUNTIME=" ${MT_RUNTIME} " is not supported. omp|tbb")
+  MESSAGE(FATAL_ERROR "MT_RUNTIME=" ${MT_RUNTIME} " is not supported. omp|tbb|native")
 endif()
 
 MESSAGE("-- MT_RUNTIME: " ${MT_RUNTIME})
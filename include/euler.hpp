@@ -4,6 +4,9 @@
 #include <stddef.h>
 #include <float.h>
 #include <tuple>
+#include <memory>
+#include <string>
+#include <vector>
 
 #define EULER_API __attribute__ ((visibility ("default")))
 
@@ -104,7 +107,37 @@ typedef enum {
 
 #define EL_NO_CALI (FLT_MAX)
 
+// Post-op kinds, see eld_conv_t::post_ops
+enum {
+  POST_OP_BIAS = 0,    // + bias argument of elx_conv()
+  POST_OP_SUM,         // + alpha * prior content of the output
+  POST_OP_RELU,        // max(x, 0)
+  POST_OP_LEAKY_RELU,  // x > 0 ? x : alpha * x
+  POST_OP_ELU,         // x > 0 ? x : alpha * (exp(x) - 1)
+  POST_OP_SWISH,       // x * sigmoid(alpha * x)
+  POST_OP_GELU,        // tanh approximation
+  POST_OP_CLIP,        // min(max(x, alpha), beta)
+  POST_OP_SCALE_SHIFT, // scale[oc] * x + shift[oc], e.g. folded BN
+  POST_OP_QUANTIZE,    // int8 output: x / alpha + beta, see output_quant
+  POST_OP_MAX_POOL,    // max over pool window, see eld_post_op_t::pool
+  POST_OP_AVG_POOL     // mean over pool window, pads excluded
+};
+
+struct eld_post_op_t {
+  int kind;
+  float alpha, beta;
+  // POST_OP_SCALE_SHIFT: oc floats each, null for 1 and 0
+  const float *scale, *shift;
+  // POST_OP_MAX_POOL/AVG_POOL, last op: window kh x kw, strides sh/sw,
+  // pads t/l on both sides. Output is n x oc x ph x pw, f32 only, with
+  // ph = (oh + 2 * t - kh) / sh + 1, pw = (ow + 2 * l - kw) / sw + 1
+  struct {
+    int kh, kw, sh, sw, t, l;
+  } pool;
+};
+
 struct elx_conv_t;
+class elx_event_t;
 
 // Convolution desc
 struct EULER_API eld_conv_t {
@@ -147,10 +180,45 @@ struct EULER_API eld_conv_t {
   bool disable_autoparam;
   bool eager_mode;
   bool stream_sync;
+  // Non-eager mode: stream to submit to, "" for the default stream
+  std::string stream_name;
+  // Benchmark candidate execution-mode/flatting/blocking/partition in
+  // setup() and keep the fastest one. Also enabled by EULER_AUTO_TUNE=1
+  bool auto_tune;
+  // Back internal workspace/scratch with 2 MiB huge pages. Also enabled
+  // by EULER_HUGE_PAGE=1
+  bool huge_page;
+  // Inference: share the transformed weights with other descriptors of
+  // equal weights content and layout, one copy per process. Winograd
+  // only. Also enabled by EULER_TWEIGHTS_CACHE=1
+  bool tweights_cache;
+  // Winograd without a user tile_size: max output error relative to the
+  // largest output, 0 to disable. setup() measures each tile size, with
+  // fp32 and f16 transformed buffers, on a sample image against a direct
+  // reference and keeps the fastest one within budget. Sample input
+  // (ic x ih x iw) and weights (oihw) in f32, null for random data.
+  float wino_error_budget;
+  struct { const float *input, *weights; } wino_calib_data;
   struct { float lower = 0, upper = FLT_MAX; } relu_bound;
+  // Ordered post-ops applied to the convolution result. When set, setup()
+  // derives with_bias/with_ip_sum/with_relu/relu_bound/output_quant from
+  // its leading bias, sum, relu/clip and trailing quantize ops; the rest
+  // are fused after them.
+  std::vector<eld_post_op_t> post_ops;
+  // Batch norm of the conv + bias result, folded into weights and bias
+  // by the first execution: gamma * (x - mean) / sqrt(var + epsilon) +
+  // beta. Arrays of oc floats read by setup(), null gamma/beta for 1/0.
+  // f32 weights and bias only. A POST_OP_SCALE_SHIFT right after the
+  // bias is folded the same way.
+  bool with_batch_norm;
+  struct {
+    const float *mean, *var, *gamma, *beta;
+    float epsilon;
+  } batch_norm;
 
   // Performance:
-  // Number of thread teams, number of threads per team
+  // Number of threads per team, 0 for all. Non-eager layers on separate
+  // streams run concurrently on disjoint CPU sets of their team sizes
   int nthreads;
   // Execution mode
   int execution_mode;
@@ -168,7 +236,14 @@ struct EULER_API eld_conv_t {
   struct { float scale, z; } input_quant, wino_tinput_quant, output_quant, sum_quant;
   sampling_kind_t sampling_kind;
 
+  // Caller-owned scratch/workspace buffers of byte_sizes.scratch and
+  // byte_sizes.workspace bytes, 64 bytes aligned, set after setup().
+  // Scratch is per execution temporary and may be shared between layers
+  // executed in sequence. Workspace keeps transformed weights, is bound on
+  // first elx_conv() and must outlive the descriptor's executions.
   void *scratch_pad;
+  bool use_workspace_pad;
+  void *workspace_pad;
   std::string name;
 
   // Defaults
@@ -178,8 +253,9 @@ struct EULER_API eld_conv_t {
   eld_conv_t& operator=(const eld_conv_t&) = delete;
   int setup(bool fully_setup = true);
 
-  // Auto computed by setup()
-  struct { size_t input, weights, output, bias; } byte_sizes;
+  // Auto computed by setup(). scratch/workspace: per execution temporary
+  // and persistent internal buffer sizes, 0 until fully setup
+  struct { size_t input, weights, output, bias, scratch, workspace; } byte_sizes;
   struct { size_t input, weights, output, bias; } sizes;
 
   // Internal data used by elx
@@ -189,6 +265,83 @@ struct EULER_API eld_conv_t {
 // Convolution execution
 int EULER_API elx_conv(eld_conv_t &desc, void *output, void *input, void *weights, void *bias);
 
+// Asynchronous execution
+//
+// Completion event of a submission, shared by handles. Null is complete
+typedef std::shared_ptr<elx_event_t> elx_event;
+
+// Submit to the desc.stream_name stream and return its completion event.
+// Execution starts once all deps completed, so independent branches put
+// on separate streams overlap while dependent layers serialize. Eager mode
+// waits deps and executes in place.
+int EULER_API elx_conv_async(eld_conv_t &desc, void *output, void *input,
+                             void *weights, void *bias,
+                             const std::vector<elx_event> &deps,
+                             elx_event &event);
+int EULER_API elx_event_wait(const elx_event &event);
+bool EULER_API elx_event_query(const elx_event &event);
+
+// Pin workers of stream name and their thread teams to cpus: a cpulist
+// "0-13,28-41", "node:N" or "socket:N". Defaults to EULER_STREAM_CPUS,
+// else the process affinity. Applies from the next submission.
+int EULER_API elx_stream_set_cpus(const std::string &name, const char *cpus);
+
+// Network arena plan
+//
+// One caller-owned scratch and one workspace arena for a list of fully
+// set-up convolutions in execution order. Scratch of layer i is live while
+// up to inflight layers execute with it, and is reused by layers outside
+// that range. Workspace is persistent and never reused.
+struct eld_conv_arena_t {
+  // Peak bytes of each arena
+  size_t scratch_size, workspace_size;
+  // Per-layer byte offsets into each arena
+  std::vector<size_t> scratch_offset, workspace_offset;
+};
+
+int EULER_API eld_conv_arena_plan(eld_conv_arena_t &arena, eld_conv_t *convs[],
+                                  int nconvs, int inflight = 1);
+
+// Point scratch_pad/workspace_pad of convs into 64 bytes aligned arenas of
+// arena.scratch_size/workspace_size bytes
+int EULER_API eld_conv_arena_bind(const eld_conv_arena_t &arena,
+                                  eld_conv_t *convs[], int nconvs,
+                                  void *scratch, void *workspace);
+
+// Depth-first conv chain
+//
+// Runs a chain of fully set-up inference convolutions, output of each
+// the input of the next, band by band of output rows of the last layer so
+// the intermediate bands stay in cache instead of round-tripping through
+// memory between layers. Band descriptors are set up internally; the
+// layers' own descriptors are only used for their shapes and options.
+// A pooling post-op of the last layer reduces its output band by band.
+struct elx_conv_chain_t;
+
+struct EULER_API eld_conv_chain_t {
+  // Output rows of the last layer per band, 0 for auto (intermediates
+  // fit in half of the team's L2). Set to the chosen height by setup()
+  int band_rows;
+  // Bands run concurrently, each by one thread on its own band
+  // descriptors and buffers sized to a core's L2: 1 on, -1 off, 0 for
+  // auto (on for int8 chains with a depthwise layer, e.g. MobileNet
+  // depthwise -> 1x1 blocks). Set to the choice by setup()
+  int thread_bands;
+
+  eld_conv_chain_t();
+  ~eld_conv_chain_t();
+  eld_conv_chain_t(const eld_conv_chain_t&) = delete;
+  eld_conv_chain_t& operator=(const eld_conv_chain_t&) = delete;
+  int setup(eld_conv_t *convs[], int nconvs);
+
+  // Internal data used by elx
+  elx_conv_chain_t *xc;
+};
+
+// weights[i]/bias[i] of layer i, bias may be null
+int EULER_API elx_conv_chain(eld_conv_chain_t &chain, void *output,
+                             void *input, void *weights[], void *bias[]);
+
 }
 
 #endif // __EULER_HPP__
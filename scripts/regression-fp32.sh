@@ -7,3 +7,80 @@ NSOCKETS=1 ./scripts/run.sh -c -i3 -h224 -o32 -H112 -k3 -K3 -s2 -S2 -p0 -P0 -n1
 # asymmetric padding, k7 s2
 NSOCKETS=1 ./scripts/run.sh -c -i3 -h224 -o64 -H112 -k7 -K7 -s2 -S2 -p3 -P3 -n1 -adirect --execution-mode=0xc060 --blk-i=1 --blk-o=2 --flt-o=2 --flt-t=14 --pat-o=1 --input-format=nchw --output-format=nChw16c --weights-format=hwio -v1
 NSOCKETS=1 ./scripts/run.sh -c -i3 -h224 -o64 -H112 -k7 -K7 -s2 -S2 -p2 -P2 -n1 -adirect --execution-mode=0xc060 --blk-i=1 --blk-o=2 --flt-o=2 --flt-t=14 --pat-o=1 --input-format=nchw --output-format=nChw16c --weights-format=hwio -v1
+
+# winograd k3 dilation 2, by polyphase decomposition
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h56 -o64 -H56 -d2 -D2 -p2 -P2 -n1 -awino -v1
+NSOCKETS=1 ./scripts/run.sh -c -i48 -h29 -o64 -H29 -d2 -D2 -p2 -P2 -n1 -awino --tile-size=6 --weights-format=oihw -v1
+
+# winograd k3 tile size 8
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h56 -o64 -H56 -n1 -awino --tile-size=8 --execution-mode=0xa061 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i128 -h28 -o128 -H28 -n1 -awino --tile-size=8 --execution-mode=0xa073 -v1
+
+# winograd transformed weights shared by content
+EULER_TWEIGHTS_CACHE=1 NSOCKETS=1 ./scripts/run.sh -c -i64 -h56 -o64 -H56 -n1 -awino --tile-size=6 --execution-mode=0xa061 -v1
+EULER_TWEIGHTS_CACHE=1 NSOCKETS=1 ./scripts/run.sh -c -i128 -h28 -o128 -H28 -n1 -awino --tile-size=6 --execution-mode=0xa073 -v1
+
+# winograd tile size by calibrated error budget
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h56 -o64 -H56 -n1 -awino --wino-error-budget=1e-5 --disable-autoparam=0 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -k5 -K5 -p2 -P2 -n1 -awino --wino-error-budget=1e-5 --execution-mode=0xa061 -v1
+
+# winograd k5, k7
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -k5 -K5 -p2 -P2 -n1 -awino --tile-size=6 --execution-mode=0xa061 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -k5 -K5 -p2 -P2 -n1 -awino --tile-size=8 --execution-mode=0xa061 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h17 -o48 -H17 -k7 -K7 -p3 -P3 -n1 -awino --tile-size=8 --execution-mode=0xa061 -v1
+
+# stream submission from many producers
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -awino --tile-size=6 --stream-producers=8 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -awino --tile-size=6 --stream-producers=8 -l8 -v0
+EULER_STREAM_WORKERS=4 NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -awino --tile-size=6 --stream-producers=8 -v1
+
+# post-op tails and sum alpha against the reference
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -adirect --disable-autoparam=0 --post-ops=leaky:0.1,elu:1,swish:1,gelu,clip:-50:300,scale_shift -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -adirect --disable-autoparam=0 --with-ip-sum=1 --sum-alpha=0.5 -r1 --post-ops=gelu,scale_shift --input-format=nhwc --weights-format=hwio --output-format=nhwc -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -k1 -K1 -p0 -P0 -n1 -adirect_1x1 --execution-mode=0xa061 --blk-i=4 --flt-o=2 --flt-t=14 --post-ops=leaky:0.1,elu:1,swish:1,gelu,clip:-50:300,scale_shift -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -k1 -K1 -p0 -P0 -n1 -adirect_1x1 --execution-mode=0xa060 --blk-i=4 --flt-o=2 --flt-t=14 --with-ip-sum=1 --sum-alpha=0.5 --post-ops=swish:0.5,scale_shift -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -k1 -K1 -p0 -P0 -n1 -adirect_1x1 --blk-i=4 --flt-o=2 --flt-t=14 --with-ip-sum=1 --sum-alpha=0.5 -r1 --post-ops=elu:0.5 --input-format=nchw --weights-format=oihw --output-format=nchw -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -k1 -K1 -p0 -P0 -n1 -adirect_1x1 --blk-i=4 --flt-o=2 --flt-t=14 --with-ip-sum=1 -r1 --input-format=nhwc --weights-format=hwio --output-format=nhwc -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -awino --tile-size=6 --execution-mode=0xa061 --post-ops=leaky:0.1,elu:1,swish:1,gelu,clip:-50:300,scale_shift -v1
+NSOCKETS=1 ./scripts/run.sh -c -i128 -h28 -o128 -H28 -n1 -awino --tile-size=6 --execution-mode=0xa073 --with-ip-sum=1 --sum-alpha=2 -r1 --post-ops=scale_shift,leaky:0.2 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -awino --tile-size=6 --with-ip-sum=1 --sum-alpha=0.5 -r1 --post-ops=swish --input-format=nchw --weights-format=oihw --output-format=nchw -v1
+
+# batch norm folded into weights and bias
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -adirect --disable-autoparam=0 --with-bn=1 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -adirect --disable-autoparam=0 --with-bn=1 --with-ip-sum=1 -r1 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -adirect --disable-autoparam=0 --with-bn=1 -b0 --post-ops=gelu --input-format=nhwc --weights-format=hwio --output-format=nhwc -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -k1 -K1 -p0 -P0 -n1 -adirect_1x1 --execution-mode=0xa061 --blk-i=4 --flt-o=2 --flt-t=14 --with-bn=1 -r1 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -awino --tile-size=6 --execution-mode=0xa061 --with-bn=1 --with-ip-sum=1 -v1
+
+# pooling post-op, 2x2 s2 and overlapping 3x3 s2 with pads
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -adirect --disable-autoparam=0 --pool=max:2:2 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -adirect --disable-autoparam=0 --pool=avg:3:2:1 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -adirect --disable-autoparam=0 --with-bn=1 -r1 --pool=max:3:2:1 --input-format=nhwc --weights-format=hwio --output-format=nhwc -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -k1 -K1 -p0 -P0 -n1 -adirect_1x1 --execution-mode=0xa061 --blk-i=4 --flt-o=2 --flt-t=14 -r1 --pool=avg:2:2 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -awino --tile-size=6 --execution-mode=0xa061 -r1 --pool=max:3:2:1 -v1
+
+# conv chain 1x1 -> conv -> 1x1 in bands, against layer by layer
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n2 -adirect --disable-autoparam=0 --chain=1x1 --band-rows=5 -r1 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n2 -adirect --disable-autoparam=0 --chain=1x1 --band-rows=3 --pool=max:3:2:1 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n2 -awino --tile-size=6 --execution-mode=0xa061 --chain=1x1 --band-rows=27 -r1 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n2 -adirect --disable-autoparam=0 --chain=1x1 --band-rows=13 --with-ip-sum=1 -r1 --input-format=nhwc --weights-format=hwio --output-format=nhwc -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n2 -awino --tile-size=6 --chain=1x1 --band-rows=1 -r1 --input-format=nchw --weights-format=oihw --output-format=nchw -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n2 -awino --tile-size=6 --chain=1x1 --band-rows=5 --with-ip-sum=1 --post-ops=gelu --input-format=nchw --weights-format=oihw --output-format=nchw -v1
+NTHREADS=4 NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -adirect --disable-autoparam=0 --chain=1x1 --band-rows=3 --thread-bands=1 -r1 -v1
+NTHREADS=4 NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -adirect --disable-autoparam=0 --chain=1x1 --band-rows=5 --thread-bands=1 --pool=max:2:2 -v1
+
+# scratch/workspace arena shared by repeated layers, 1 and 2 layers inflight
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -awino --tile-size=6 --execution-mode=0xa061 --arena=1 --arena-inflight=1 -l4 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -awino --tile-size=6 --execution-mode=0xa061 --arena=1 --arena-inflight=2 -l4 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -adirect --disable-autoparam=0 --arena=1 --arena-inflight=2 -l3 -r1 --with-ip-sum=1 -v1
+
+# auto-tune of xopt and blocking, validated on the tuned config
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -awino --auto-tune=1 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -adirect --auto-tune=1 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -adirect --auto-tune=1 --input-format=nhwc --weights-format=hwio --output-format=nhwc -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o128 -H28 -k1 -K1 -p0 -P0 -n1 -adirect_1x1 --blk-i=4 --flt-o=2 --flt-t=14 --auto-tune=1 -v1
+
+# tuning cache, second run loads the config tuned by the first
+rm -rf /tmp/euler-tuning-cache-regression && mkdir -p /tmp/euler-tuning-cache-regression
+EULER_TUNING_CACHE_DIR=/tmp/euler-tuning-cache-regression NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -aauto --auto-tune=1 -v1
+EULER_TUNING_CACHE_DIR=/tmp/euler-tuning-cache-regression NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o64 -H28 -n1 -aauto --auto-tune=1 -v1
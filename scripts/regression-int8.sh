@@ -0,0 +1,13 @@
+#!/bin/bash
+
+# int8 depthwise 3x3 and 1x1 of the MobileNet block, layer by layer
+NSOCKETS=1 ./scripts/run.sh -c -g64 -i64 -h28 -o64 -H28 -n1 -adirect --execution-mode=0xc160 --flt-t=14 --weights-format=ghwio --data-type-cfg=U8F32U8F32 -r1 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o128 -H28 -k1 -K1 -p0 -P0 -n1 -adirect_1x1 --execution-mode=0xa160 --blk-i=4 --flt-o=2 --flt-t=14 --weights-format=OIhw16i16o --data-type-cfg=U8F32U8F32 -r1 -v1
+
+# conv chain depthwise 3x3 -> 1x1 (MobileNet block) in bands, against layer by layer
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o128 -H28 -k1 -K1 -p0 -P0 -n1 -adirect_1x1 --blk-i=4 --flt-o=2 --flt-t=14 --weights-format=OIhw16i16o --data-type-cfg=U8F32U8F32 --chain=dw -r1 -v1
+NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o128 -H28 -k1 -K1 -p0 -P0 -n2 -adirect_1x1 --blk-i=4 --flt-o=2 --flt-t=14 --weights-format=OIhw16i16o --data-type-cfg=U8F32U8F32 --chain=dw --band-rows=5 --thread-bands=-1 -r1 -v1
+NTHREADS=4 NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o128 -H28 -k1 -K1 -p0 -P0 -n1 -adirect_1x1 --blk-i=4 --flt-o=2 --flt-t=14 --weights-format=OIhw16i16o --data-type-cfg=U8F32U8F32 --chain=dw -r1 -v1
+NTHREADS=4 NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o128 -H28 -k1 -K1 -p0 -P0 -n1 -adirect_1x1 --blk-i=4 --flt-o=2 --flt-t=14 --weights-format=OIhw16i16o --data-type-cfg=U8F32U8F32 --chain=dw --band-rows=3 --thread-bands=1 -r1 -v1
+NTHREADS=4 NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o128 -H28 -k1 -K1 -p0 -P0 -n1 -adirect_1x1 --blk-i=4 --flt-o=2 --flt-t=14 --weights-format=OIhw16i16o --data-type-cfg=U8F32U8F32 --chain=dw --band-rows=1 --thread-bands=1 -r1 -v1
+NTHREADS=4 NSOCKETS=1 ./scripts/run.sh -c -i64 -h28 -o128 -H28 -k1 -K1 -p0 -P0 -n1 -adirect_1x1 --blk-i=4 --flt-o=2 --flt-t=14 --weights-format=OIhw16i16o --data-type-cfg=U8F32U8F32 --chain=dw --band-rows=27 --thread-bands=-1 -v1
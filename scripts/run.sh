@@ -31,20 +31,24 @@ fi
 
 function conv_test() {
   # Default
-  n=1; g=1; i=0; o=0; h=0; w=0; H=0; W=0; k=3; K=3; p=1; P=1; s=1; S=1
+  n=1; g=1; i=0; o=0; h=0; w=0; H=0; W=0; k=3; K=3; p=1; P=1; s=1; S=1; d=1; D=1
   b=1; r=0; v=1; a=wino; l=1; B=0; A=0; T=0
   flt_o=0; flt_t=0; blk_i=0; blk_o=0; pat_i=1; pat_o=1
-  tile_size=0; nthreads=0; execution_mode=0
+  tile_size=0; wino_error_budget=0; nthreads=0; execution_mode=0
   streaming_input=0; streaming_output=0
   input_format=nChw16c; weights_format=OIhw16i16o; output_format=nChw16c
   input_as_blocked=0; weights_as_blocked=0; output_as_blocked=0
   with_ip_sum=0; with_argmax=0; f16c_opt=0; data_type_cfg=0
   input_file=""; weights_file=""; bias_file=""
   sampling_kind=2; tinput_cali_s=0; tinput_cali_z=0
-  disable_autoparam=1; name="ioi"
+  disable_autoparam=1; auto_tune=0; arena=0; arena_inflight=1
+  stream_producers=0
+  post_ops=""; sum_alpha=1.0; with_bn=0; pool=""
+  chain=""; band_rows=0; thread_bands=0
+  name="ioi"
 
   OPTIND=1
-  while getopts ":n:g:i:o:h:w:H:W:k:K:p:P:s:S:b:r:v:f:l:B:A:a:-:" opt; do
+  while getopts ":n:g:i:o:h:w:H:W:k:K:p:P:s:S:d:D:b:r:v:f:l:B:A:a:-:" opt; do
     case "$opt" in
       g) g=$OPTARG ;;
       n) n=$OPTARG ;;
@@ -60,6 +64,8 @@ function conv_test() {
       P) P=$OPTARG ;;
       s) s=$OPTARG ;;
       S) S=$OPTARG ;;
+      d) d=$OPTARG ;;
+      D) D=$OPTARG ;;
       b) b=$OPTARG ;;
       r) r=$OPTARG ;;
       v) v=$OPTARG ;;
@@ -109,6 +115,10 @@ function conv_test() {
             ;;
           tile-size=*) tile_size=${OPTARG#*=}
             ;;
+          wino-error-budget) wino_error_budget="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          wino-error-budget=*) wino_error_budget=${OPTARG#*=}
+            ;;
           streaming-input) streaming_input="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
             ;;
           streaming-input=*) streaming_input=${OPTARG#*=}
@@ -185,6 +195,50 @@ function conv_test() {
             ;;
           disable-autoparam=*) disable_autoparam=${OPTARG#*=}
             ;;
+          auto-tune) auto_tune="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          auto-tune=*) auto_tune=${OPTARG#*=}
+            ;;
+          stream-producers) stream_producers="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          stream-producers=*) stream_producers=${OPTARG#*=}
+            ;;
+          arena) arena="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          arena=*) arena=${OPTARG#*=}
+            ;;
+          arena-inflight) arena_inflight="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          arena-inflight=*) arena_inflight=${OPTARG#*=}
+            ;;
+          post-ops) post_ops="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          post-ops=*) post_ops=${OPTARG#*=}
+            ;;
+          sum-alpha) sum_alpha="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          sum-alpha=*) sum_alpha=${OPTARG#*=}
+            ;;
+          with-bn) with_bn="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          with-bn=*) with_bn=${OPTARG#*=}
+            ;;
+          pool) pool="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          pool=*) pool=${OPTARG#*=}
+            ;;
+          chain) chain="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          chain=*) chain=${OPTARG#*=}
+            ;;
+          band-rows) band_rows="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          band-rows=*) band_rows=${OPTARG#*=}
+            ;;
+          thread-bands) thread_bands="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
+            ;;
+          thread-bands=*) thread_bands=${OPTARG#*=}
+            ;;
           name) name="${!OPTIND}"; OPTIND=$(( $OPTIND + 1 ))
             ;;
           name=*) name=${OPTARG#*=}
@@ -206,10 +260,11 @@ function conv_test() {
   fi
   #set -v
   eval $OMP_ENV EULER_LOG_LEVEL=$euler_log_level $ROOT_DIR/$build_dir/tests/elt_conv \
-    -mb=$n -g=$g -ic=$i -oc=$o -ih=$h -iw=$w -oh=$H -ow=$W -kh=$k -kw=$K -ph=$p -pw=$P -sh=$s -sw=$S \
+    -mb=$n -g=$g -ic=$i -oc=$o -ih=$h -iw=$w -oh=$H -ow=$W -kh=$k -kw=$K -ph=$p -pw=$P -sh=$s -sw=$S -dh=$d -dw=$D \
     -with_bias=$b -with_relu=$r -validate_results=$v -alg=$a -repeated_layer=$l -dbuffering=$B -output_as_input=$A \
     -flt_o=$flt_o -flt_t=$flt_t -blk_i=$blk_i -blk_o=$blk_o \
     -pat_i=$pat_i -pat_o=$pat_o -tile_size=$tile_size \
+    -wino_error_budget=$wino_error_budget \
     -nthreads=$nthreads -execution_mode=$execution_mode \
     -streaming_input=$streaming_input \
     -streaming_output=$streaming_output \
@@ -227,6 +282,17 @@ function conv_test() {
     -tinput_cali_s=$tinput_cali_s \
     -tinput_cali_z=$tinput_cali_z \
     -disable_autoparam=$disable_autoparam \
+    -auto_tune=$auto_tune \
+    -arena=$arena \
+    -arena_inflight=$arena_inflight \
+    -post_ops=$post_ops \
+    -sum_alpha=$sum_alpha \
+    -with_bn=$with_bn \
+    -pool=$pool \
+    -chain=$chain \
+    -band_rows=$band_rows \
+    -thread_bands=$thread_bands \
+    -stream_producers=$stream_producers \
     -name=$name \
     $input_file_opt \
     $weights_file_opt \
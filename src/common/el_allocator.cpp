@@ -0,0 +1,313 @@
+#include <condition_variable>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "el_def.hpp"
+#include "el_utils.hpp"
+#include "el_stl.hpp"
+#include "el_allocator.hpp"
+
+namespace euler {
+
+struct walloc_block_t {
+  char *base;
+  size_t size;
+  size_t in_use;
+  bool huge_page;
+  // Free regions, offset -> size
+  std::map<size_t, size_t> free_;
+};
+
+struct walloc_arena_t {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<walloc_block_t>> blocks;
+  // Acquired regions, ptr -> (block, size)
+  std::unordered_map<void *, std::pair<walloc_block_t *, size_t>> live;
+  walloc::stats_t stats = { 0, 0, 0, 0, 0 };
+};
+
+// Never destroyed, workspaces may outlive static destruction
+static walloc_arena_t &walloc_arena() {
+  static auto *arena = new walloc_arena_t;
+  return *arena;
+}
+
+void *el_mmap(size_t size, bool huge_page, int fd) {
+  int flags = fd == -1 ? MAP_PRIVATE | MAP_ANONYMOUS : MAP_SHARED;
+  if (!huge_page) {
+    void *p = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, fd, 0);
+    return p == MAP_FAILED ? nullptr : p;
+  }
+
+  if (fd == -1) {
+    void *p = mmap(nullptr, alignup(size, HUGE_PAGE_SIZE),
+                   PROT_READ | PROT_WRITE, flags | MAP_HUGETLB, -1, 0);
+    if (p != MAP_FAILED)
+      return p;
+  }
+
+  // Reserve an over-sized range, trim it to 2 MiB alignment, then map
+  size_t map_size = size + HUGE_PAGE_SIZE;
+  char *q = (char *)mmap(nullptr, map_size, PROT_NONE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (q == (char *)MAP_FAILED)
+    return nullptr;
+  char *aligned = (char *)alignup((size_t)q, HUGE_PAGE_SIZE);
+  if (aligned > q)
+    munmap(q, aligned - q);
+  if (q + map_size > aligned + size)
+    munmap(aligned + size, q + map_size - aligned - size);
+  void *p = mmap(aligned, size, PROT_READ | PROT_WRITE, flags | MAP_FIXED,
+                 fd, 0);
+  if (p == MAP_FAILED) {
+    munmap(aligned, size);
+    return nullptr;
+  }
+  madvise(p, size, MADV_HUGEPAGE);
+  return p;
+}
+
+void *walloc::acquire(size_t size, bool huge_page)
+{
+  auto &arena = walloc_arena();
+  std::lock_guard<std::mutex> lock(arena.mutex);
+  size_t sz = alignup(size == 0 ? 1 : size, 64);
+
+  // First fit in existing blocks
+  walloc_block_t *blk = nullptr;
+  size_t offset = 0;
+  for (auto &b : arena.blocks) {
+    if (b->huge_page != huge_page)
+      continue;
+    for (auto &f : b->free_) {
+      if (f.second >= sz) {
+        blk = b.get();
+        offset = f.first;
+        break;
+      }
+    }
+    if (blk != nullptr)
+      break;
+  }
+
+  // Chain a new block
+  if (blk == nullptr) {
+    size_t bsz = alignup(estl::max(sz, (size_t)WS_BLOCK_SIZE),
+                         huge_page ? HUGE_PAGE_SIZE : PAGE_SIZE);
+    void *base = el_mmap(bsz, huge_page);
+    if (base == nullptr) {
+      el_error("walloc: mmap failed");
+      return nullptr;
+    }
+    std::unique_ptr<walloc_block_t> b(new walloc_block_t);
+    b->base = (char *)base;
+    b->size = bsz;
+    b->in_use = 0;
+    b->huge_page = huge_page;
+    b->free_[0] = bsz;
+    blk = b.get();
+    offset = 0;
+    arena.blocks.push_back(std::move(b));
+    arena.stats.nblocks++;
+    arena.stats.reserved += bsz;
+    el_log(__DEBUG, "walloc: block %zu bytes, blocks=%zu, reserved=%zu",
+           bsz, arena.stats.nblocks, arena.stats.reserved);
+  }
+
+  auto it = blk->free_.find(offset);
+  size_t fsz = it->second;
+  blk->free_.erase(it);
+  if (fsz > sz)
+    blk->free_[offset + sz] = fsz - sz;
+  blk->in_use += sz;
+
+  void *p = blk->base + offset;
+  arena.live[p] = { blk, sz };
+  arena.stats.in_use += sz;
+  arena.stats.peak = estl::max(arena.stats.peak, arena.stats.in_use);
+  arena.stats.nallocs++;
+  return p;
+}
+
+void walloc::release(void *ptr)
+{
+  if (ptr == nullptr)
+    return;
+
+  auto &arena = walloc_arena();
+  std::lock_guard<std::mutex> lock(arena.mutex);
+  auto it = arena.live.find(ptr);
+  if (it == arena.live.end()) {
+    el_warn("walloc: release of unknown pointer");
+    return;
+  }
+  walloc_block_t *blk = it->second.first;
+  size_t sz = it->second.second;
+  arena.live.erase(it);
+  arena.stats.in_use -= sz;
+  blk->in_use -= sz;
+
+  // Coalesce with neighbor free regions
+  size_t offset = (char *)ptr - blk->base;
+  auto next = blk->free_.lower_bound(offset);
+  if (next != blk->free_.end() && next->first == offset + sz) {
+    sz += next->second;
+    next = blk->free_.erase(next);
+  }
+  if (next != blk->free_.begin()) {
+    auto prev = std::prev(next);
+    if (prev->first + prev->second == offset) {
+      offset = prev->first;
+      sz += prev->second;
+      blk->free_.erase(prev);
+    }
+  }
+  blk->free_[offset] = sz;
+
+  // Return empty block
+  if (blk->in_use == 0) {
+    for (auto b = arena.blocks.begin(); b != arena.blocks.end(); ++b) {
+      if (b->get() == blk) {
+        munmap(blk->base, blk->size);
+        arena.stats.nblocks--;
+        arena.stats.reserved -= blk->size;
+        arena.blocks.erase(b);
+        break;
+      }
+    }
+    if (arena.blocks.empty())
+      el_log(__DEBUG, "walloc: empty, peak=%zu, allocs=%zu",
+             arena.stats.peak, arena.stats.nallocs);
+  }
+}
+
+walloc::stats_t walloc::stats()
+{
+  auto &arena = walloc_arena();
+  std::lock_guard<std::mutex> lock(arena.mutex);
+  return arena.stats;
+}
+
+struct wcache_entry_t {
+  void *ptr;
+  size_t map_size;
+  bool mapped;
+  size_t ref_cnt;
+  // Filled, acquirers of a pending entry wait on wcache_t::filled
+  bool ready;
+  // Copy of the source bytes, compared on hits
+  std::string source;
+};
+
+struct wcache_t {
+  std::mutex mutex;
+  std::condition_variable filled;
+  // Key -> entries, several if sources collide on the key
+  std::unordered_multimap<std::string, wcache_entry_t *> entries;
+  // Buffer -> key
+  std::unordered_map<void *, std::string> keys;
+};
+
+static wcache_t &wcache_instance() {
+  static wcache_t cache;
+  return cache;
+}
+
+void *wcache::acquire(const std::string &key, size_t size, bool huge_page,
+                      const std::function<void(void *)> &fill,
+                      const void *source, size_t source_size)
+{
+  auto &cache = wcache_instance();
+  std::unique_lock<std::mutex> lock(cache.mutex);
+
+  auto range = cache.entries.equal_range(key);
+  for (auto it = range.first; it != range.second; ++it) {
+    wcache_entry_t *e = it->second;
+    if (source != nullptr && (e->source.size() != source_size
+        || memcmp(e->source.data(), source, source_size) != 0))
+      continue;
+    // Referenced, a pending entry outlives its wait
+    ++e->ref_cnt;
+    cache.filled.wait(lock, [e]() { return e->ready; });
+    el_log(__DEBUG, "wcache: hit, key=%s, refs=%zu", key.c_str(),
+           e->ref_cnt);
+    return e->ptr;
+  }
+
+  auto *e = new wcache_entry_t;
+  e->map_size = alignup(size == 0 ? 1 : size,
+                        huge_page ? HUGE_PAGE_SIZE : PAGE_SIZE);
+  e->ptr = el_mmap(e->map_size, huge_page);
+  e->mapped = e->ptr != nullptr;
+  if (e->ptr == nullptr && memalign64(&e->ptr, e->map_size) != 0) {
+    delete e;
+    el_error("wcache: allocation failed");
+    return nullptr;
+  }
+  e->ref_cnt = 1;
+  e->ready = false;
+  if (source != nullptr)
+    e->source.assign((const char *)source, source_size);
+  cache.entries.emplace(key, e);
+  cache.keys[e->ptr] = key;
+
+  // Fill a pending entry outside the lock, other keys go on meanwhile
+  lock.unlock();
+  fill(e->ptr);
+  lock.lock();
+  e->ready = true;
+  cache.filled.notify_all();
+  el_log(__DEBUG, "wcache: miss, key=%s, size=%zu", key.c_str(), size);
+  return e->ptr;
+}
+
+void wcache::release(void *ptr)
+{
+  auto &cache = wcache_instance();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+
+  auto k = cache.keys.find(ptr);
+  if (k == cache.keys.end()) {
+    el_warn("wcache: release of unknown pointer");
+    return;
+  }
+  auto range = cache.entries.equal_range(k->second);
+  auto it = range.first;
+  while (it != range.second && it->second->ptr != ptr)
+    ++it;
+  wcache_entry_t *e = it->second;
+  if (--e->ref_cnt == 0) {
+    if (e->mapped)
+      munmap(e->ptr, e->map_size);
+    else
+      ::free(e->ptr);
+    cache.entries.erase(it);
+    cache.keys.erase(k);
+    delete e;
+  }
+}
+
+uint64_t wcache::hash(const void *ptr, size_t size)
+{
+  // Multiply-xorshift over 8 byte words, then the tail bytes
+  const uint64_t m = 0x9e3779b97f4a7c15ULL;
+  const char *p = (const char *)ptr;
+  uint64_t h = size * m;
+  size_t n = size / 8;
+  for (size_t i = 0; i < n; ++i) {
+    uint64_t k;
+    memcpy(&k, p + i * 8, 8);
+    k *= m;
+    k ^= k >> 29;
+    h = (h ^ k) * m;
+    h ^= h >> 32;
+  }
+  for (size_t i = n * 8; i < size; ++i)
+    h = (h ^ (uint8_t)p[i]) * m;
+  return h;
+}
+
+}  // namespace euler
@@ -10,6 +10,8 @@
 #include <string.h>
 #include <unistd.h>
 #include <semaphore.h>
+#include <functional>
+#include <string>
 #include "el_utils.hpp"
 
 namespace euler {
@@ -36,6 +38,11 @@ private:
   int fd_;
 };
 
+// Map size bytes, anonymous private (fd == -1) or shared on fd. With
+// huge_page the mapping is 2 MiB aligned and huge page backed: hugetlbfs
+// if reserved (anonymous only), transparent huge pages otherwise.
+void *el_mmap(size_t size, bool huge_page, int fd = -1);
+
 // TODO: to-be-replaced with user provided buffer
 struct galloc {
   static void *&get() {
@@ -53,14 +60,39 @@ struct galloc {
     return ref_cnt_;
   }
 
-  static void *acquire(size_t size)
+  // ptr_ is mmap'd
+  static bool &mapped() {
+    thread_local static bool mapped_;
+    return mapped_;
+  }
+
+  static void free_buffer() {
+    auto &ptr_ = get();
+    if (ptr_ == nullptr)
+      return;
+    if (mapped())
+      munmap(ptr_, sz());
+    else
+      ::free(ptr_);
+    ptr_ = nullptr;
+    sz() = 0;
+  }
+
+  // first_touch: fresh pages, placed on the node of the first writer
+  static void *acquire(size_t size, bool huge_page = false,
+                       bool first_touch = false)
   {
     auto &sz_ = sz();
     auto &ptr_ = get();
-    size_t sz = ALIGNUP(size, 64);
+    size_t sz = huge_page ? alignup(size, HUGE_PAGE_SIZE)
+                          : first_touch ? alignup(size, PAGE_SIZE)
+                                        : ALIGNUP(size, 64);
     if (sz > sz_) {
-      if (ptr_) ::free(ptr_);
-      memalign64(&ptr_, sz);
+      free_buffer();
+      ptr_ = huge_page || first_touch ? el_mmap(sz, huge_page) : nullptr;
+      mapped() = ptr_ != nullptr;
+      if (ptr_ == nullptr)
+        memalign64(&ptr_, sz);
       sz_ = sz;
     }
     ++ref_cnt();
@@ -68,71 +100,46 @@ struct galloc {
   }
 
   static void release() {
-    auto &sz_ = sz();
-    auto &ptr_ = get();
     auto &cnt_ = ref_cnt();
-    if (--cnt_ == 0 && ptr_ != nullptr) {
-      ::free(ptr_);
-      ptr_ = nullptr;
-      sz_ = 0;
-    }
+    if (--cnt_ == 0)
+      free_buffer();
   }
 };
 
 #define WS_BLOCK_SIZE (64 * 1024 * 1024)
+// Process-wide workspace arena. Chains WS_BLOCK_SIZE blocks (or a
+// dedicated block for larger requests), first-fit with coalescing
+// release, and returns empty blocks to the OS. Huge page requests are
+// served from separate huge page backed blocks. Thread safe: a region
+// may be released by any thread, e.g. a stream worker tearing down a
+// layer first run elsewhere.
 struct walloc {
-  static void *&get() {
-    thread_local static void *ptr_ = nullptr;
-    return ptr_;
-  }
-
-  static size_t &sz() {
-    thread_local static size_t sz_ = 0;
-    return sz_;
-  }
-
-  static size_t &ref_cnt() {
-    thread_local static size_t ref_cnt_ = 0;
-    return ref_cnt_;
-  }
+  struct stats_t {
+    size_t nblocks;  // blocks mapped
+    size_t reserved; // bytes mapped
+    size_t in_use;   // bytes acquired
+    size_t peak;     // max in_use
+    size_t nallocs;  // acquire calls
+  };
 
-  static void *acquire(size_t size)
-  {
-    auto &sz_ = sz();
-    auto &ptr_ = get();
-    auto &cnt_ = ref_cnt();
-    if (ptr_ == nullptr) {
-      memalign64(&ptr_, WS_BLOCK_SIZE);
-    }
-    auto sz = ALIGNUP(size, 64);
-    auto old_sz = sz_;
-    auto new_sz = sz_ + sz;
-    if (new_sz < WS_BLOCK_SIZE) {
-      sz_ = new_sz;
-      ++cnt_;
-      return (char *)ptr_ + old_sz;
-    } else {
-      void *p = nullptr;
-      memalign64(&p, sz);
-      return p;
-    }
-  }
+  static void *acquire(size_t size, bool huge_page = false);
+  static void release(void *ptr);
+  static stats_t stats();
+};
 
-  static void release(void *ptr) {
-    auto &sz_ = sz();
-    auto &ptr_ = get();
-    auto &cnt_ = ref_cnt();
-    if (ptr >= ptr_ && ptr < ((char *)ptr_ + WS_BLOCK_SIZE)) {
-      if (--cnt_ == 0 && ptr_ != nullptr) {
-        ::free(ptr_);
-        ptr_ = nullptr;
-        sz_ = 0;
-      }
-    } else {
-      ::free(ptr);
-      ptr = nullptr;
-    }
-  }
+// Process-wide cache of read-only workspaces by content key, e.g. the
+// transformed weights of engines with equal weights and layout. Entries
+// are reference counted and unmapped by their last release. With a
+// source, a hit also needs equal source bytes, so a key collision never
+// shares a buffer. On a miss, fill(ptr) initializes the new buffer
+// outside the cache lock; concurrent acquirers of the entry wait for it.
+struct wcache {
+  static void *acquire(const std::string &key, size_t size, bool huge_page,
+                       const std::function<void(void *)> &fill,
+                       const void *source = nullptr, size_t source_size = 0);
+  static void release(void *ptr);
+  // 64-bit hash of size bytes at ptr
+  static uint64_t hash(const void *ptr, size_t size);
 };
 
 #define SETUP_DONE_MASK (0xAABBCCDD)
@@ -163,7 +170,7 @@ struct shwalloc {
     return fd_;
   }
 
-  static void *acquire(size_t size, const char *key)
+  static void *acquire(size_t size, const char *key, bool huge_page = false)
   {
     auto &sz_ = sz();
     auto &ptr_ = get();
@@ -185,7 +192,7 @@ struct shwalloc {
       if (ftruncate(fd_, WS_BLOCK_SIZE)) {
         el_error("Euler: ftruncate failed");
       }
-      ptr_ = mmap(0, WS_BLOCK_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+      ptr_ = el_mmap(WS_BLOCK_SIZE, huge_page, fd_);
     }
     auto sz = alignup(size + hdr_size, 64);
     auto old_sz = sz_;
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <tuple>
 
 #define MT_RUNTIME_OMP (1)
 #define MT_RUNTIME_TBB (2)
+#define MT_RUNTIME_NATIVE (3)
 
 namespace euler {
 
@@ -26,6 +28,7 @@ enum {
 };
 
 constexpr size_t PAGE_SIZE = 4096;
+constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
 
 // int8 quantization
 constexpr float EL_INT8_MAX = 127.0f;
@@ -46,6 +49,7 @@ constexpr uint32_t AT_RESTORE_OUTPUT_MASK   { 1 << 5 };
 constexpr uint32_t AT_Ir_MASK               { 1 << 6 };
 constexpr uint32_t AT_Or_MASK               { 1 << 7 };
 constexpr uint32_t AT_FMAOPT_MASK           { 1 << 8 }; // FMA optimization
+constexpr uint32_t AT_POST_OPS_MASK         { 1 << 9 }; // ep.post_ops
 
 template <typename... Types> struct ConvImplTypes {
   static_assert(sizeof...(Types) == 4,
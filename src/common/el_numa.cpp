@@ -0,0 +1,141 @@
+#include <dirent.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <algorithm>
+#include <vector>
+#include "el_def.hpp"
+#include "el_utils.hpp"
+#include "el_numa.hpp"
+
+namespace euler {
+
+struct el_numa_topology_t {
+  int nnodes;
+  std::vector<int> cpu_node;
+};
+
+// Parse cpulist "0-27,56-83" into ascending CPU ids
+static bool parse_cpulist(const char *str, std::vector<int> &cpus)
+{
+  const char *p = str;
+  while (*p != '\0' && *p != '\n') {
+    char *end;
+    long first = strtol(p, &end, 10), last = first;
+    if (end == p || first < 0)
+      return false;
+    p = end;
+    if (*p == '-') {
+      last = strtol(p + 1, &end, 10);
+      if (end == p + 1 || last < first)
+        return false;
+      p = end;
+    }
+    for (long cpu = first; cpu <= last; ++cpu)
+      cpus.push_back(cpu);
+    if (*p == ',')
+      ++p;
+    else if (*p != '\0' && *p != '\n')
+      return false;
+  }
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+  return true;
+}
+
+static void read_node_cpulist(int node_id, int node, std::vector<int> &cpu_node)
+{
+  char path[128], buf[4096];
+  snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist",
+           node_id);
+  FILE *fp = fopen(path, "r");
+  if (fp == nullptr)
+    return;
+
+  std::vector<int> cpus;
+  if (fgets(buf, sizeof(buf), fp) != nullptr && parse_cpulist(buf, cpus)) {
+    for (auto cpu : cpus) {
+      if (cpu >= (int)cpu_node.size())
+        cpu_node.resize(cpu + 1, 0);
+      cpu_node[cpu] = node;
+    }
+  }
+  fclose(fp);
+}
+
+static const el_numa_topology_t &el_numa_topology() {
+  static el_numa_topology_t topo = []() {
+    el_numa_topology_t t;
+    t.nnodes = 1;
+
+    std::vector<int> ids;
+    DIR *dir = opendir("/sys/devices/system/node");
+    if (dir != nullptr) {
+      struct dirent *ent;
+      while ((ent = readdir(dir)) != nullptr) {
+        int id;
+        if (sscanf(ent->d_name, "node%d", &id) == 1)
+          ids.push_back(id);
+      }
+      closedir(dir);
+    }
+    std::sort(ids.begin(), ids.end());
+
+    for (size_t i = 0; i < ids.size(); ++i)
+      read_node_cpulist(ids[i], i, t.cpu_node);
+    if (ids.size() > 1)
+      t.nnodes = ids.size();
+
+    el_log(__DEBUG, "numa: nodes=%d, cpus=%zu", t.nnodes, t.cpu_node.size());
+    return t;
+  }();
+  return topo;
+}
+
+int el_numa_nodes() {
+  return el_numa_topology().nnodes;
+}
+
+int el_numa_node_of_cpu(int cpu) {
+  auto &t = el_numa_topology();
+  return cpu >= 0 && cpu < (int)t.cpu_node.size() ? t.cpu_node[cpu] : 0;
+}
+
+int el_numa_current_node() {
+  return el_numa_node_of_cpu(sched_getcpu());
+}
+
+int el_cpu_socket(int cpu) {
+  char path[128];
+  snprintf(path, sizeof(path),
+           "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", cpu);
+  FILE *fp = fopen(path, "r");
+  if (fp == nullptr)
+    return 0;
+  int socket = 0;
+  if (fscanf(fp, "%d", &socket) != 1)
+    socket = 0;
+  fclose(fp);
+  return socket;
+}
+
+bool el_parse_cpus(const char *spec, std::vector<int> &cpus)
+{
+  cpus.clear();
+  int id;
+  if (sscanf(spec, "node:%d", &id) == 1
+      || sscanf(spec, "socket:%d", &id) == 1) {
+    bool node = spec[0] == 'n';
+    int ncpus = sysconf(_SC_NPROCESSORS_CONF);
+    for (int cpu = 0; cpu < ncpus; ++cpu) {
+      int of = node ? el_numa_node_of_cpu(cpu) : el_cpu_socket(cpu);
+      if (of == id)
+        cpus.push_back(cpu);
+    }
+    return true;
+  }
+  return parse_cpulist(spec, cpus);
+}
+
+}  // namespace euler
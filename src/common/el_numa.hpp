@@ -0,0 +1,20 @@
+#pragma once
+
+#include <vector>
+
+namespace euler {
+
+// NUMA topology from /sys/devices/system/node, nodes numbered densely in
+// ascending node id order. One node if sysfs is not available.
+int el_numa_nodes();
+int el_numa_node_of_cpu(int cpu);
+// Node of the CPU the calling thread runs on
+int el_numa_current_node();
+
+// Socket (physical package id) of cpu, 0 if sysfs is not available
+int el_cpu_socket(int cpu);
+// CPU ids, ascending, of spec: a cpulist "0-27,56-83", "node:N" or
+// "socket:N". Returns false if spec is malformed.
+bool el_parse_cpus(const char *spec, std::vector<int> &cpus);
+
+}  // namespace euler
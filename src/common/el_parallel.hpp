@@ -1,14 +1,21 @@
 #pragma once
 
+#include <stdint.h>
 #include <type_traits>
 #include <cstdlib>
 #include <cassert>
+#include <atomic>
+#include <memory>
 #include "el_def.hpp"
+#include "el_utils.hpp"
 #if MT_RUNTIME == MT_RUNTIME_OMP
 # include <omp.h>
 #elif MT_RUNTIME == MT_RUNTIME_TBB
 # include "tbb/parallel_for.h"
 # include "tbb/task_arena.h"
+# include <unordered_map>
+#elif MT_RUNTIME == MT_RUNTIME_NATIVE
+# include "el_thread_pool.hpp"
 #else
 # error Invalid MT_RUNTIME
 #endif
@@ -45,6 +52,18 @@ static inline int max_concurrency() {
 #define THREAD_FOR(N, mthr, ithr, ...) estl::thread_parallel_for<N>(mthr, ithr, __VA_ARGS__)
 #define THREAD_FOR2(N, M, mthr, ithr, ...) estl::thread_parallel_for<N, M>(mthr, ithr, __VA_ARGS__)
 
+// Run func with parallel regions of the calling thread sized nthr
+template <typename F> static inline void team_run(int nthr, F func) {
+  int saved = omp_get_max_threads();
+  if (nthr == saved) {
+    func();
+    return;
+  }
+  omp_set_num_threads(nthr);
+  func();
+  omp_set_num_threads(saved);
+}
+
 #elif MT_RUNTIME == MT_RUNTIME_TBB
 static inline int current_thread_index() {
   return tbb::this_task_arena::current_thread_index();
@@ -56,6 +75,54 @@ static inline int max_concurrency() {
 #define THREAD_BARRIER()
 #define THREAD_FOR(N, mthr, ithr, ...) estl::parallel_for<N>(mthr, __VA_ARGS__)
 #define THREAD_FOR2(N, M, mthr, ithr, ...) estl::parallel_for<N, M>(mthr, __VA_ARGS__)
+
+// Run func in a task arena of nthr slots, one arena per size and thread
+template <typename F> static inline void team_run(int nthr, F func) {
+  if (nthr == tbb::this_task_arena::max_concurrency()) {
+    func();
+    return;
+  }
+  thread_local std::unordered_map<int, std::unique_ptr<tbb::task_arena>>
+      arenas;
+  auto &arena = arenas[nthr];
+  if (arena == nullptr)
+    arena.reset(new tbb::task_arena(nthr));
+  arena->execute(func);
+}
+
+#elif MT_RUNTIME == MT_RUNTIME_NATIVE
+static inline int current_thread_index() {
+  return el_pool_thread_index();
+}
+static inline int max_concurrency() {
+  return el_pool_max_threads();
+}
+
+// Run func(ithr) on a team of nthr pool threads
+template <typename F> static inline void pool_parallel(int nthr, F &func) {
+  el_pool_parallel(nthr, [](void *ctx, int ithr) { (*(F *)ctx)(ithr); },
+                   &func);
+}
+
+struct pool_region_t {
+  template <typename F> void operator+(F func) {
+    pool_parallel(max_concurrency(), func);
+  }
+};
+
+// Region body becomes a lambda, close it with "};"
+#define THREAD_PARALLEL() estl::pool_region_t() + [&](int)
+#define THREAD_BARRIER() el_pool_barrier();
+#define THREAD_FOR(N, mthr, ithr, ...) estl::thread_parallel_for<N>(mthr, ithr, __VA_ARGS__)
+#define THREAD_FOR2(N, M, mthr, ithr, ...) estl::thread_parallel_for<N, M>(mthr, ithr, __VA_ARGS__)
+
+// Run func with parallel regions of the calling thread sized nthr
+template <typename F> static inline void team_run(int nthr, F func) {
+  int saved = el_pool_max_threads();
+  el_pool_set_max_threads(nthr);
+  func();
+  el_pool_set_max_threads(saved);
+}
 #endif // MT_RUNTIME
 
 // Loops over N loops in current thread.
@@ -161,6 +228,179 @@ template <int N, int M = -1> struct thread_parallel_for {
   int nb_tasks_, task_start_, task_end_;
 };
 
+// Calls func(idx[0], ..., idx[N-1])
+template <int N, int L = 0> struct index_call {
+  template <typename F, typename... Is>
+  static inline void call(F &func, const int *idx, Is... is) {
+    index_call<N, L + 1>::call(func, idx, is..., idx[L]);
+  }
+};
+
+template <int N> struct index_call<N, N> {
+  template <typename F, typename... Is>
+  static inline void call(F &func, const int *, Is... is) {
+    func(is...);
+  }
+};
+
+// Work-stealing variant of thread_parallel_for over N loops.
+//
+// Each thread starts on the contiguous range thread_parallel_for would
+// give it and takes grain tasks at a time from its front, so per-thread
+// locality state in func (e.g. a t2_history capture) behaves as in the
+// static split. A thread out of work steals the back half of the largest
+// range it finds and continues on it as owner. Ranges are packed
+// [begin, end) words updated by CAS.
+template <int N> struct dynamic_parallel_for {
+  static_assert(N > 0, "N > 0 required");
+
+  struct alignas(64) range_t {
+    std::atomic<uint64_t> r;
+  };
+  // Over-aligned, by memalign64 rather than new[]
+  struct range_free_t {
+    void operator()(range_t *p) const { ::free(p); }
+  };
+  static inline range_t *alloc_ranges(int n) {
+    range_t *p = nullptr;
+    if (memalign64(&p, n * sizeof(range_t)) != 0)
+      el_error("dynamic_parallel_for: range allocation failed");
+    for (int i = 0; i < n; ++i)
+      new (&p[i]) range_t;
+    return p;
+  }
+
+  static inline uint64_t pack(uint32_t begin, uint32_t end) {
+    return (uint64_t)end << 32 | begin;
+  }
+  static inline uint32_t begin_of(uint64_t r) { return (uint32_t)r; }
+  static inline uint32_t end_of(uint64_t r) { return (uint32_t)(r >> 32); }
+
+  template <typename... Args>
+  dynamic_parallel_for(int mthr, int grain, Args... Xs)
+      : loops_{ Xs... }, mthr_(mthr), grain_(grain < 1 ? 1 : grain),
+        ranges_(alloc_ranges(mthr))
+  {
+    static_assert(N == sizeof...(Xs), "N != sizeof(Xs...)");
+    nb_tasks_ = 1;
+    for (int i = 0; i < N; ++i)
+      nb_tasks_ *= loops_[i];
+
+    auto res = std::div(nb_tasks_, mthr);
+    for (int ithr = 0, start = 0; ithr < mthr; ++ithr) {
+      int end = start + res.quot + (ithr < res.rem);
+      ranges_[ithr].r.store(pack(start, end), std::memory_order_relaxed);
+      start = end;
+    }
+  }
+
+  template <typename F> inline void run(int ithr, F func) {
+    for (;;) {
+      int begin, end;
+      while (take(ithr, begin, end))
+        loop_range(func, begin, end);
+      if (!steal(ithr))
+        break;
+    }
+  }
+
+  private:
+  // Next grain tasks of own range
+  inline bool take(int ithr, int &begin, int &end) {
+    auto &range = ranges_[ithr].r;
+    uint64_t r = range.load(std::memory_order_acquire);
+    for (;;) {
+      uint32_t b = begin_of(r), e = end_of(r);
+      if (b >= e)
+        return false;
+      uint32_t nb = e - b > (uint32_t)grain_ ? b + grain_ : e;
+      if (range.compare_exchange_weak(r, pack(nb, e),
+                                      std::memory_order_acq_rel)) {
+        begin = b;
+        end = nb;
+        return true;
+      }
+    }
+  }
+
+  // Move back half of the largest victim range into own range
+  inline bool steal(int ithr) {
+    for (;;) {
+      int victim = -1;
+      uint32_t most = 0;
+      for (int i = 1; i < mthr_; ++i) {
+        int v = (ithr + i) % mthr_;
+        uint64_t r = ranges_[v].r.load(std::memory_order_acquire);
+        uint32_t rem = end_of(r) > begin_of(r) ? end_of(r) - begin_of(r) : 0;
+        if (rem > most) {
+          most = rem;
+          victim = v;
+        }
+      }
+      if (victim < 0)
+        return false;
+
+      auto &range = ranges_[victim].r;
+      uint64_t r = range.load(std::memory_order_acquire);
+      uint32_t b = begin_of(r), e = end_of(r);
+      if (b >= e)
+        continue;
+      uint32_t take = e - b > (uint32_t)grain_ ? (e - b + 1) / 2 : e - b;
+      if (range.compare_exchange_strong(r, pack(b, e - take),
+                                        std::memory_order_acq_rel)) {
+        ranges_[ithr].r.store(pack(e - take, e), std::memory_order_release);
+        return true;
+      }
+    }
+  }
+
+  template <typename F> inline void loop_range(F &func, int begin, int end) {
+    int idx[N];
+    int n = begin;
+    for (auto i = N - 1; i >= 0; --i) {
+      auto res = std::div(n, loops_[i]);
+      idx[i] = res.rem;
+      n = res.quot;
+    }
+    for (int t = begin; t < end; ++t) {
+      index_call<N>::call(func, idx);
+      for (auto i = N - 1; i >= 0; --i) {
+        if (++idx[i] < loops_[i])
+          break;
+        idx[i] = 0;
+      }
+    }
+  }
+
+  int loops_[N];
+  int nb_tasks_, mthr_, grain_;
+  std::unique_ptr<range_t[], range_free_t> ranges_;
+};
+
+// parallel_for with work stealing for imbalanced task spaces, e.g. tail
+// tiles. func is copied per thread like parallel_for.
+template <int N, typename F, typename... Args>
+static inline void parallel_for_dynamic(int mthr, int grain, F func,
+                                        Args... args)
+{
+  dynamic_parallel_for<N> sched(mthr, grain, args...);
+#if MT_RUNTIME == MT_RUNTIME_OMP
+#pragma omp parallel num_threads(mthr) proc_bind(close)
+  {
+    sched.run(omp_get_thread_num(), func);
+  }
+#elif MT_RUNTIME == MT_RUNTIME_TBB
+  tbb::parallel_for(0, mthr, [&](int ithr) {
+    sched.run(ithr, func);
+  }, tbb::static_partitioner());
+#elif MT_RUNTIME == MT_RUNTIME_NATIVE
+  auto region = [&](int ithr) {
+    sched.run(ithr, func);
+  };
+  pool_parallel(mthr, region);
+#endif
+}
+
 template <int N, int M, typename F, typename... Args>
 static inline void parallel_for(int mthr, F func, Args... args)
 {
@@ -174,6 +414,11 @@ static inline void parallel_for(int mthr, F func, Args... args)
   tbb::parallel_for(0, mthr, [&](int ithr) {
     thread_parallel_for<N, M>(mthr, ithr, func, args...);
   }, tbb::static_partitioner());
+#elif MT_RUNTIME == MT_RUNTIME_NATIVE
+  auto region = [&](int ithr) {
+    thread_parallel_for<N, M>(mthr, ithr, func, args...);
+  };
+  pool_parallel(mthr, region);
 #endif
 }
 
@@ -191,6 +436,11 @@ static inline void parallel_for(F func, Args... args)
   tbb::parallel_for(0, mthr, [&](int ithr) {
     thread_parallel_for<N, M>(mthr, ithr, func, args...);
   }, tbb::static_partitioner());
+#elif MT_RUNTIME == MT_RUNTIME_NATIVE
+  auto region = [&](int ithr) {
+    thread_parallel_for<N, M>(mthr, ithr, func, args...);
+  };
+  pool_parallel(mthr, region);
 #endif
 }
 
@@ -207,24 +457,33 @@ static inline void parallel_for(int mthr, F func, Args... args)
   tbb::parallel_for(0, mthr, [&](int ithr) {
     thread_parallel_for<N, -1>(mthr, ithr, func, args...);
   }, tbb::static_partitioner());
+#elif MT_RUNTIME == MT_RUNTIME_NATIVE
+  auto region = [&](int ithr) {
+    thread_parallel_for<N, -1>(mthr, ithr, func, args...);
+  };
+  pool_parallel(mthr, region);
 #endif
 }
 
 template <int N, typename F, typename... Args>
 static inline void parallel_for(F func, Args... args)
 {
+  int mthr = estl::max_concurrency();
 #if MT_RUNTIME == MT_RUNTIME_OMP
-#pragma omp parallel proc_bind(close)
+#pragma omp parallel num_threads(mthr) proc_bind(close)
   {
-    int mthr = omp_get_max_threads();
     int ithr = omp_get_thread_num();
     thread_parallel_for<N, -1>(mthr, ithr, func, args...);
   }
 #elif MT_RUNTIME == MT_RUNTIME_TBB
-  int mthr = estl::max_concurrency();
   tbb::parallel_for(0, mthr, [&](int ithr) {
     thread_parallel_for<N, -1>(mthr, ithr, func, args...);
   }, tbb::static_partitioner());
+#elif MT_RUNTIME == MT_RUNTIME_NATIVE
+  auto region = [&](int ithr) {
+    thread_parallel_for<N, -1>(mthr, ithr, func, args...);
+  };
+  pool_parallel(mthr, region);
 #endif
 }
 
@@ -0,0 +1,223 @@
+#include <limits.h>
+#include <sched.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "el_utils.hpp"
+#include "el_stl.hpp"
+#include "el_init.hpp"
+#include "el_thread_pool.hpp"
+
+namespace euler {
+
+// Region word: generation << POOL_NTHR_BITS | team size
+#define POOL_NTHR_BITS 12
+#define POOL_MAX_THREADS ((1 << POOL_NTHR_BITS) - 1)
+
+static inline void futex_wait(std::atomic<int> *addr, int val) {
+  syscall(SYS_futex, (int *)addr, FUTEX_WAIT_PRIVATE, val, nullptr, nullptr, 0);
+}
+
+static inline void futex_wake(std::atomic<int> *addr, int n) {
+  syscall(SYS_futex, (int *)addr, FUTEX_WAKE_PRIVATE, n, nullptr, nullptr, 0);
+}
+
+static inline void cpu_relax() {
+  __builtin_ia32_pause();
+}
+
+// Spin up to blocktime for word != val, then sleep on it
+static void wait_change(std::atomic<int> &word, int val,
+                        std::atomic<int> &sleepers) {
+  if (ego.blocktime > 0) {
+    auto deadline = std::chrono::steady_clock::now()
+        + std::chrono::milliseconds(ego.blocktime);
+    for (int i = 0;; ++i) {
+      if (word.load(std::memory_order_acquire) != val)
+        return;
+      cpu_relax();
+      // Yield now and then, for oversubscribed CPUs
+      if ((i & 1023) == 1023) {
+        if (std::chrono::steady_clock::now() >= deadline)
+          break;
+        sched_yield();
+      }
+    }
+  }
+  sleepers.fetch_add(1, std::memory_order_seq_cst);
+  while (word.load(std::memory_order_seq_cst) == val)
+    futex_wait(&word, val);
+  sleepers.fetch_sub(1, std::memory_order_seq_cst);
+}
+
+static inline void notify(std::atomic<int> &word, std::atomic<int> &sleepers) {
+  if (sleepers.load(std::memory_order_seq_cst) > 0)
+    futex_wake(&word, INT_MAX);
+}
+
+struct pool_t {
+  pool_t() : fn(nullptr), ctx(nullptr), nthr(1), gen(0), exit(false),
+      word(0), word_sleepers(0), pending(0), pending_sleepers(0),
+      bar_count(0), bar_gen(0), bar_sleepers(0) {}
+  ~pool_t();
+  void publish(int n);
+
+  // Region, stable while its participants run
+  void (*fn)(void *, int);
+  void *ctx;
+  int nthr, gen;
+  std::atomic<bool> exit;
+
+  alignas(64) std::atomic<int> word;
+  std::atomic<int> word_sleepers;
+  alignas(64) std::atomic<int> pending; // workers still in region
+  std::atomic<int> pending_sleepers;
+  alignas(64) std::atomic<int> bar_count;
+  std::atomic<int> bar_gen;
+  std::atomic<int> bar_sleepers;
+
+  std::vector<std::thread> workers;
+};
+
+// Over-aligned, by memalign64 rather than new
+struct pool_free_t {
+  void operator()(pool_t *p) const {
+    p->~pool_t();
+    ::free(p);
+  }
+};
+
+static inline pool_t *pool_create() {
+  void *p = nullptr;
+  if (memalign64(&p, sizeof(pool_t)) != 0)
+    return nullptr;
+  return new (p) pool_t;
+}
+
+struct pool_tls_t {
+  pool_t *team = nullptr; // region the thread runs in
+  int ithr = 0;
+  int max_threads = 0;
+  std::unique_ptr<pool_t, pool_free_t> own;
+};
+
+static thread_local pool_tls_t tls;
+
+void pool_t::publish(int n) {
+  gen = (gen + 1) & (INT_MAX >> POOL_NTHR_BITS);
+  word.store(gen << POOL_NTHR_BITS | n, std::memory_order_seq_cst);
+  notify(word, word_sleepers);
+}
+
+pool_t::~pool_t() {
+  exit.store(true, std::memory_order_release);
+  publish(0);
+  for (auto &w : workers)
+    w.join();
+}
+
+static void pool_worker(pool_t *pool, int ithr, int seen) {
+  tls.team = pool;
+  tls.ithr = ithr;
+  for (;;) {
+    wait_change(pool->word, seen, pool->word_sleepers);
+    seen = pool->word.load(std::memory_order_acquire);
+    if (pool->exit.load(std::memory_order_acquire))
+      break;
+    // Non-participants never touch region fields
+    if (ithr < (seen & POOL_MAX_THREADS)) {
+      pool->fn(pool->ctx, ithr);
+      if (pool->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        notify(pool->pending, pool->pending_sleepers);
+    }
+  }
+}
+
+static int default_max_threads() {
+  static int n = []() {
+    if (ego.num_threads > 0)
+      return ego.num_threads;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0)
+      return CPU_COUNT(&set);
+    return (int)std::thread::hardware_concurrency();
+  }();
+  return n;
+}
+
+void el_pool_parallel(int nthr, void (*fn)(void *, int), void *ctx) {
+  nthr = estl::min(nthr, POOL_MAX_THREADS);
+  if (nthr > 1 && tls.team == nullptr && tls.own == nullptr)
+    tls.own.reset(pool_create());
+  if (nthr <= 1 || tls.team != nullptr || tls.own == nullptr) {
+    // Nested, single or no pool: run serially on the calling thread
+    pool_t *team = tls.team;
+    int ithr = tls.ithr;
+    tls.team = nullptr;
+    for (int i = 0; i < nthr; ++i) {
+      tls.ithr = i;
+      fn(ctx, i);
+    }
+    tls.team = team;
+    tls.ithr = ithr;
+    return;
+  }
+
+  pool_t *pool = tls.own.get();
+  while ((int)pool->workers.size() < nthr - 1) {
+    int seen = pool->word.load(std::memory_order_relaxed);
+    pool->workers.emplace_back(pool_worker, pool, pool->workers.size() + 1,
+                               seen);
+  }
+
+  pool->fn = fn;
+  pool->ctx = ctx;
+  pool->nthr = nthr;
+  pool->pending.store(nthr - 1, std::memory_order_relaxed);
+  pool->publish(nthr);
+
+  tls.team = pool;
+  tls.ithr = 0;
+  fn(ctx, 0);
+  tls.team = nullptr;
+
+  int v;
+  while ((v = pool->pending.load(std::memory_order_acquire)) != 0)
+    wait_change(pool->pending, v, pool->pending_sleepers);
+}
+
+void el_pool_barrier() {
+  pool_t *pool = tls.team;
+  if (pool == nullptr || pool->nthr <= 1)
+    return;
+  int g = pool->bar_gen.load(std::memory_order_acquire);
+  if (pool->bar_count.fetch_add(1, std::memory_order_acq_rel)
+      == pool->nthr - 1) {
+    pool->bar_count.store(0, std::memory_order_relaxed);
+    pool->bar_gen.fetch_add(1, std::memory_order_seq_cst);
+    notify(pool->bar_gen, pool->bar_sleepers);
+  } else {
+    while (pool->bar_gen.load(std::memory_order_acquire) == g)
+      wait_change(pool->bar_gen, g, pool->bar_sleepers);
+  }
+}
+
+int el_pool_thread_index() {
+  return tls.ithr;
+}
+
+int el_pool_max_threads() {
+  return tls.max_threads > 0 ? tls.max_threads : default_max_threads();
+}
+
+void el_pool_set_max_threads(int nthr) {
+  tls.max_threads = nthr;
+}
+
+}  // namespace euler
@@ -0,0 +1,25 @@
+#pragma once
+
+// Native MT runtime (MT_RUNTIME_NATIVE)
+//
+// A thread starting a parallel region runs it as thread 0 of a team with
+// workers of its own pool, created on demand and kept across regions, so
+// no fork/join per region and no OpenMP runtime. Idle workers and barrier
+// waiters spin for EULER_BLOCKTIME ms (default 200, like KMP_BLOCKTIME)
+// then sleep on a futex. Regions started inside a region run serially.
+
+#define EL_POOL_API __attribute__((visibility("default")))
+
+namespace euler {
+
+EL_POOL_API void el_pool_parallel(int nthr, void (*fn)(void *, int),
+                                  void *ctx);
+EL_POOL_API void el_pool_barrier();
+// Thread index in the current region, 0 outside regions
+EL_POOL_API int el_pool_thread_index();
+// Team size of regions started by the calling thread, EULER_NUM_THREADS
+// or the number of CPUs of the process affinity by default
+EL_POOL_API int el_pool_max_threads();
+EL_POOL_API void el_pool_set_max_threads(int nthr);
+
+}  // namespace euler
@@ -149,6 +149,7 @@ static inline const char *mt_runtime_to_string(int t) {
   switch (t) {
     case MT_RUNTIME_TBB: return "TBB";
     case MT_RUNTIME_OMP: return "OMP";
+    case MT_RUNTIME_NATIVE: return "NATIVE";
     default: return "mt-runtime-unknown";
   }
   return "unknown";
@@ -21,6 +21,51 @@ __attribute__((constructor)) void el_init() {
     ego.verbose = 1;
   }
 
+  auto env_auto_tune = ::getenv("EULER_AUTO_TUNE");
+  if (env_auto_tune != nullptr && env_auto_tune[0] == '1') {
+    ego.auto_tune = true;
+  }
+
+  auto env_tuning_cache_dir = ::getenv("EULER_TUNING_CACHE_DIR");
+  if (env_tuning_cache_dir != nullptr && env_tuning_cache_dir[0] != '\0') {
+    ego.tuning_cache_dir = env_tuning_cache_dir;
+  }
+
+  auto env_huge_page = ::getenv("EULER_HUGE_PAGE");
+  if (env_huge_page != nullptr && env_huge_page[0] == '1') {
+    ego.huge_page = true;
+  }
+
+  auto env_tweights_cache = ::getenv("EULER_TWEIGHTS_CACHE");
+  if (env_tweights_cache != nullptr && env_tweights_cache[0] == '1') {
+    ego.tweights_cache = true;
+  }
+
+  auto env_numa = ::getenv("EULER_NUMA");
+  if (env_numa != nullptr && env_numa[0] == '1') {
+    ego.numa = true;
+  }
+
+  auto env_stream_workers = ::getenv("EULER_STREAM_WORKERS");
+  if (env_stream_workers != nullptr && atoi(env_stream_workers) > 0) {
+    ego.stream_workers = atoi(env_stream_workers);
+  }
+
+  auto env_stream_cpus = ::getenv("EULER_STREAM_CPUS");
+  if (env_stream_cpus != nullptr && env_stream_cpus[0] != '\0') {
+    ego.stream_cpus = env_stream_cpus;
+  }
+
+  auto env_num_threads = ::getenv("EULER_NUM_THREADS");
+  if (env_num_threads != nullptr && atoi(env_num_threads) > 0) {
+    ego.num_threads = atoi(env_num_threads);
+  }
+
+  auto env_blocktime = ::getenv("EULER_BLOCKTIME");
+  if (env_blocktime != nullptr && atoi(env_blocktime) >= 0) {
+    ego.blocktime = atoi(env_blocktime);
+  }
+
   auto env_log_level = ::getenv("EULER_LOG_LEVEL");
   if (env_log_level != nullptr) {
     ego.log_level = atoi(env_log_level);
@@ -12,6 +12,15 @@ namespace euler {
 struct el_global_option {
   int log_level = __INFO;
   bool verbose = false; // for EULER_VERBOSE
+  bool auto_tune = false; // for EULER_AUTO_TUNE
+  const char *tuning_cache_dir = nullptr; // for EULER_TUNING_CACHE_DIR
+  bool huge_page = false; // for EULER_HUGE_PAGE
+  bool tweights_cache = false; // for EULER_TWEIGHTS_CACHE
+  bool numa = false; // for EULER_NUMA
+  int stream_workers = 1; // for EULER_STREAM_WORKERS
+  const char *stream_cpus = nullptr; // for EULER_STREAM_CPUS
+  int num_threads = 0; // for EULER_NUM_THREADS, native MT runtime
+  int blocktime = 200; // for EULER_BLOCKTIME, ms, native MT runtime
   bool initialized = false;
 };
 
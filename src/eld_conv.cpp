@@ -5,7 +5,14 @@
 #include "el_def.hpp"
 #include "el_isa.hpp"
 #include "el_utils.hpp"
+#include "el_init.hpp"
 #include "elx_conv.hpp"
+#include "elx_conv_cost.hpp"
+#include "elx_conv_tuner.hpp"
+#include "elx_conv_tuning_cache.hpp"
+#include "elx_conv_polyphase.hpp"
+#include "elx_conv_wino_calib.hpp"
+#include "elx_post_ops.hpp"
 #include "elx_conv_wino.hpp"
 #include "elx_int8_conv_wino.hpp"
 #include "elx_conv_direct_1x1.hpp"
@@ -25,6 +32,7 @@ eld_conv_t::eld_conv_t()
   strides = { 1, 1 };
   dilations = { 1, 1 };
   sizes = { 0, 0, 0, 0 };
+  byte_sizes = { 0, 0, 0, 0, 0, 0 };
   algorithm = CONV_DIRECT;
   name = "ioi";
   tile_size = 0;
@@ -33,6 +41,8 @@ eld_conv_t::eld_conv_t()
   with_ip_sum = false;
   with_op_sum = false;
   with_argmax = false;
+  with_batch_norm = false;
+  batch_norm = { nullptr, nullptr, nullptr, nullptr, 1e-5f };
   f16c_opt = false;
   xc = nullptr;
   nthreads = 0;
@@ -47,6 +57,16 @@ eld_conv_t::eld_conv_t()
   sampling_kind = FINE;
   eager_mode = true;
   stream_sync = false;
+  stream_name = "";
+  auto_tune = false;
+  huge_page = false;
+  tweights_cache = false;
+  wino_error_budget = 0.0f;
+  wino_calib_data = { nullptr, nullptr };
+  use_scratch_pad = false;
+  scratch_pad = nullptr;
+  use_workspace_pad = false;
+  workspace_pad = nullptr;
 }
 
 eld_conv_t::~eld_conv_t()
@@ -64,8 +84,6 @@ int eld_conv_t::setup(bool fully_setup)
   const int ic = dims.ic / g;
   const int oc = dims.oc / g;
 
-  bool depthwise = (g == dims.ic && g == dims.oc);
-
   if (V != 16) {
     // TODO: V == 8
     el_error("CPU vector not support");
@@ -87,14 +105,10 @@ int eld_conv_t::setup(bool fully_setup)
 
   using dt = decltype(data_type);
   uint32_t user_type = data_type.flat;
-  uint32_t user_type_f32 = dt{ { { f32, f32, f32, f32 } } }.flat;
-  uint32_t user_type_f16o = dt{ { { f32, f32, f16, f32 } } }.flat;
   uint32_t user_type_u8f32f32f32 = dt{ { { u8, f32, f32, f32 } } }.flat;
   uint32_t user_type_u8f32u8f32 = dt{ { { u8, f32, u8, f32 } } }.flat;
   uint32_t user_type_u8f32s8f32 = dt{ { { u8, f32, s8, f32 } } }.flat;
-#ifdef ENABLE_USER_FP16
-  uint32_t user_type_f16 = dt{ { { f16, f16, f16, f16 } } }.flat;
-#endif
+  uint32_t user_type_f32 = dt{ { { f32, f32, f32, f32 } } }.flat;
 
   sizes.input = dims.n * dims.ih * dims.iw *
       (estl::any_of(formats.input, nChw16c, nChw8c) ? ALIGNUP(dims.ic, V)
@@ -125,14 +139,16 @@ int eld_conv_t::setup(bool fully_setup)
   byte_sizes.output = get_elem_size(data_type.output) * sizes.output;
   byte_sizes.bias = get_elem_size(data_type.bias) * sizes.bias;
 
-  // Validate padding
+  // Validate padding, against the effective (dilated) kernel
+  int kh = (dims.kh - 1) * dilations.h + 1;
+  int kw = (dims.kw - 1) * dilations.w + 1;
   int oh, ow;
   if (algorithm == DECONV_DIRECT) {
-    oh = (dims.ih - 1) * strides.h + dims.kh - pads.t - pads.b;
-    ow = (dims.iw - 1) * strides.w + dims.kw - pads.l - pads.r;
+    oh = (dims.ih - 1) * strides.h + kh - pads.t - pads.b;
+    ow = (dims.iw - 1) * strides.w + kw - pads.l - pads.r;
   } else { // CONV
-    oh = (dims.ih + pads.t + pads.b - dims.kh) / strides.h + 1;
-    ow = (dims.iw + pads.l + pads.r - dims.kw) / strides.w + 1;
+    oh = (dims.ih + pads.t + pads.b - kh) / strides.h + 1;
+    ow = (dims.iw + pads.l + pads.r - kw) / strides.w + 1;
   }
   if (oh != dims.oh || ow != dims.ow) {
     el_warn("Padding parameter error. pads.r/pads.b will be auto adjusted");
@@ -145,6 +161,45 @@ int eld_conv_t::setup(bool fully_setup)
     return ELD_GENERAL_ERROR;
   }
 
+  if (with_batch_norm && (batch_norm.mean == nullptr
+      || batch_norm.var == nullptr || !post_ops_foldable(*this))) {
+    el_error("Batch norm: mean/var required, f32 weights and bias only");
+    return ELD_UNIMPLEMENTED;
+  }
+
+  // Fused flags from the post-op list
+  if (!post_ops.empty()) {
+    int ret = post_ops_lower(*this);
+    if (ret != ELD_OK)
+      return ret;
+  }
+
+  // Pooled output
+  auto pool = post_ops_pool(post_ops);
+  if (pool != nullptr) {
+    int ph, pw;
+    post_ops_pool_dims(*this, *pool, ph, pw);
+    sizes.output = dims.n * ph * pw *
+        (estl::any_of(formats.output, nChw16c, nChw8c) ? ALIGNUP(dims.oc, V)
+                                                       : dims.oc);
+    byte_sizes.output = get_elem_size(data_type.output) * sizes.output;
+  }
+
+  // Tuning cache, keyed on user request before the cost model, calibration
+  // and autoparam resolve it. A hit sets algorithm and tile size, which
+  // the cost model then keeps
+  bool user_tile_size = tile_size != 0;
+  std::string tuning_key;
+  bool tuning_hit = false, polyphase = false;
+  if (fully_setup && tuning_cache_enabled()) {
+    tuning_key = tuning_cache_key(*this);
+    tuning_hit = tuning_cache_load(tuning_key, *this);
+  }
+
+  // Algorithm and Winograd tile size by cost model
+  conv_cost_select(*this);
+
+  // Fallback: no engine supported by the cost model
   if (algorithm == CONV_AUTO) {
     if (dims.kh == 1 && dims.kw == 1) {
       algorithm = CONV_DIRECT_1X1;
@@ -162,92 +217,219 @@ int eld_conv_t::setup(bool fully_setup)
     return ELD_OK;
   }
 
+  if (algorithm == CONV_DIRECT_1X1) {
+    if (dims.kh != 1 || dims.kw != 1) {
+      el_error("Algorithm CONV_DIRECT_1X1 not supported for this shape.");
+      return ELD_GENERAL_ERROR;
+    }
+  } else if (algorithm == CONV_WINOGRAD) {
+    // Winograd, dilated by polyphase decomposition
+    if (dims.kh != dims.kw || !estl::any_of(dims.kh, 3, 5, 7)) {
+      el_error("Algorithm CONV_WINOGRAD: data shape not supported");
+      return ELD_UNIMPLEMENTED;
+    }
+    if (dilations.h > 1 || dilations.w > 1 ||
+        strides.h != 1 || strides.w != 1) {
+      if (!polyphase_supported(*this) || user_type != user_type_f32) {
+        el_error("Algorithm CONV_WINOGRAD: dilated shape supported for 3x3, "
+                 "stride 1, f32, oihw/hwio/OIhw16i16o weights only");
+        return ELD_UNIMPLEMENTED;
+      }
+      polyphase = true;
+    }
+
+    if ((user_type == user_type_u8f32u8f32 ||
+        user_type == user_type_u8f32s8f32 ||
+        user_type == user_type_u8f32f32f32) &&
+        input_quant.z != 0) {
+      el_error("Support abs-max scaling for input only in Conv Winograd ...");
+    }
+
+    // 5x5 and 7x7: fp32 stride-1 only
+    if (dims.kh != 3 && (polyphase || user_type != user_type_f32
+        || (execution_mode & 0xF00) == 0x100)) {
+      el_error("Algorithm CONV_WINOGRAD: 5x5/7x7 supported for f32, "
+               "stride 1 only");
+      return ELD_UNIMPLEMENTED;
+    }
+
+    if (tile_size == 0)
+      tile_size = dims.kh == 3 ? 4 : dims.kh == 5 ? 6 : 8;
+    if (!elx_conv_wino_supported(tile_size, dims.kh)) {
+      el_error("Algorithm CONV_WINOGRAD: tile size not supported for "
+               "this kernel size");
+      return ELD_UNIMPLEMENTED;
+    }
+
+    // Cached f16c_opt, tuned or calibrated, over the autoparam default.
+    // f16 transformed buffers reach ~5e-2 max error at tile size 8,
+    // autoparam keeps it to fp32
+    if (!disable_autoparam && !tuning_hit) f16c_opt = tile_size < 8;
+
+    // Tile size and f16c_opt within the error budget, on sample data
+    if (wino_error_budget > 0.0f && !user_tile_size && !tuning_hit
+        && !polyphase && user_type == user_type_f32
+        && (execution_mode & 0xF00) != 0x100)
+      elx_conv_wino_calibrate(*this);
+
+    if (tile_size == 8 && f16c_opt) {
+      el_error("Algorithm CONV_WINOGRAD: tile size 8 not supported with "
+               "f16c_opt");
+      return ELD_UNIMPLEMENTED;
+    }
+  }
+
+  // Pooling: band descriptors are tuned on their own, polyphase:
+  // the sub-convolution
+  if (!tuning_hit && (auto_tune || ego.auto_tune) && pool == nullptr
+      && !polyphase) {
+    if (elx_conv_auto_tune(*this) == ELD_OK && tuning_cache_enabled())
+      tuning_cache_store(tuning_key, *this);
+  }
+
+  if (pool != nullptr)
+    xc = create_elx_conv_pool(*this);
+  else if (polyphase)
+    xc = create_elx_conv_polyphase(*this);
+  else
+    xc = create_elx_conv(*this);
+  if (xc != nullptr) {
+    byte_sizes.scratch = xc->scratch_size_;
+    byte_sizes.workspace = xc->workspace_size_;
+  }
+
+  return ELD_OK;
+}
+
+void conv_desc_clone(eld_conv_t &d, const eld_conv_t &s)
+{
+  d.dims = s.dims;
+  d.pads = s.pads;
+  d.strides = s.strides;
+  d.dilations = s.dilations;
+  d.data_type = s.data_type;
+  d.formats = s.formats;
+  d.prop_kind = s.prop_kind;
+  d.algorithm = s.algorithm;
+  d.tile_size = s.tile_size;
+  d.with_relu = s.with_relu;
+  d.with_bias = s.with_bias;
+  d.with_ip_sum = s.with_ip_sum;
+  d.f16c_opt = s.f16c_opt;
+  d.is_inference = s.is_inference;
+  d.disable_autoparam = s.disable_autoparam;
+  d.auto_tune = s.auto_tune;
+  d.huge_page = s.huge_page;
+  d.tweights_cache = s.tweights_cache;
+  d.relu_bound = s.relu_bound;
+  d.post_ops = s.post_ops;
+  d.with_batch_norm = s.with_batch_norm;
+  d.batch_norm = s.batch_norm;
+  d.nthreads = s.nthreads;
+  d.execution_mode = s.execution_mode;
+  d.flatting = s.flatting;
+  d.blocking = s.blocking;
+  d.partition = s.partition;
+  d.streaming_hint = s.streaming_hint;
+  d.format_as_blocked = s.format_as_blocked;
+  d.input_quant = s.input_quant;
+  d.wino_tinput_quant = s.wino_tinput_quant;
+  d.output_quant = s.output_quant;
+  d.sum_quant = s.sum_quant;
+  d.sampling_kind = s.sampling_kind;
+  d.name = s.name;
+}
+
+elx_conv_t *create_elx_conv(eld_conv_t &dc)
+{
+  elx_conv_t *xc = nullptr;
+
+  const int g = dc.dims.g;
+  bool depthwise = (g == dc.dims.ic && g == dc.dims.oc);
+
+  using dt = decltype(dc.data_type);
+  uint32_t user_type = dc.data_type.flat;
+  uint32_t user_type_f32 = dt{ { { f32, f32, f32, f32 } } }.flat;
+  uint32_t user_type_f16o = dt{ { { f32, f32, f16, f32 } } }.flat;
+  uint32_t user_type_u8f32f32f32 = dt{ { { u8, f32, f32, f32 } } }.flat;
+  uint32_t user_type_u8f32u8f32 = dt{ { { u8, f32, u8, f32 } } }.flat;
+  uint32_t user_type_u8f32s8f32 = dt{ { { u8, f32, s8, f32 } } }.flat;
+#ifdef ENABLE_USER_FP16
+  uint32_t user_type_f16 = dt{ { { f16, f16, f16, f16 } } }.flat;
+#endif
+
   // Direct
-  if (algorithm == CONV_DIRECT) {
+  if (dc.algorithm == CONV_DIRECT) {
     if (user_type == user_type_f32) {
-      if (f16c_opt)
-        xc = new elx_conv_direct_t<conv::FP32, conv_impl::FP32_F16w, 16, ISA_AVX512>(*this);
+      if (dc.f16c_opt)
+        xc = new elx_conv_direct_t<conv::FP32, conv_impl::FP32_F16w, 16, ISA_AVX512>(dc);
       else
-        xc = new elx_conv_direct_t<conv::FP32, conv_impl::FP32, 16, ISA_AVX512>(*this);
+        xc = new elx_conv_direct_t<conv::FP32, conv_impl::FP32, 16, ISA_AVX512>(dc);
     } else if (user_type == user_type_u8f32u8f32) {
       if (depthwise)
-        xc = new elx_int8_conv_direct_depthwise_t<conv::U8F32U8F32, conv_impl::INT8_F32, 16, ISA_AVX512>(*this);
+        xc = new elx_int8_conv_direct_depthwise_t<conv::U8F32U8F32, conv_impl::INT8_F32, 16, ISA_AVX512>(dc);
       else
-        xc = new elx_int8_conv_direct_t<conv::U8F32U8F32, conv_impl::INT8_F32, 16, ISA_AVX512>(*this);
+        xc = new elx_int8_conv_direct_t<conv::U8F32U8F32, conv_impl::INT8_F32, 16, ISA_AVX512>(dc);
     } else if (user_type == user_type_u8f32s8f32) {
       if (depthwise)
-        xc = new elx_int8_conv_direct_depthwise_t<conv::U8F32S8F32, conv_impl::INT8_F32, 16, ISA_AVX512>(*this);
+        xc = new elx_int8_conv_direct_depthwise_t<conv::U8F32S8F32, conv_impl::INT8_F32, 16, ISA_AVX512>(dc);
       else
-        xc = new elx_int8_conv_direct_t<conv::U8F32S8F32, conv_impl::INT8_F32, 16, ISA_AVX512>(*this);
+        xc = new elx_int8_conv_direct_t<conv::U8F32S8F32, conv_impl::INT8_F32, 16, ISA_AVX512>(dc);
     } else if (user_type == user_type_u8f32f32f32) {
-        xc = new elx_int8_conv_direct_t<conv::U8F32F32F32, conv_impl::INT8_F32, 16, ISA_AVX512>(*this);
+        xc = new elx_int8_conv_direct_t<conv::U8F32F32F32, conv_impl::INT8_F32, 16, ISA_AVX512>(dc);
 #ifdef ENABLE_USER_FP16
     } else if (user_type == user_type_f16o) {
-      xc = new elx_conv_direct_t<conv::FP16O, conv_impl::FP32_F16o, 16, ISA_AVX512>(*this);
+      xc = new elx_conv_direct_t<conv::FP16O, conv_impl::FP32_F16o, 16, ISA_AVX512>(dc);
 #endif
     } else
       el_error("TODO: FP16 UserTypes for DIRECT.");
-  } else if (algorithm == CONV_DIRECT_VMG) {
+  } else if (dc.algorithm == CONV_DIRECT_VMG) {
     if (user_type == user_type_f32) {
-      if (f16c_opt)
-        xc = new elx_conv_direct_vmg_t<conv::FP32, conv_impl::FP32_F16w, 16, ISA_AVX512>(*this);
+      if (dc.f16c_opt)
+        xc = new elx_conv_direct_vmg_t<conv::FP32, conv_impl::FP32_F16w, 16, ISA_AVX512>(dc);
       else
-        xc = new elx_conv_direct_vmg_t<conv::FP32, conv_impl::FP32, 16, ISA_AVX512>(*this);
+        xc = new elx_conv_direct_vmg_t<conv::FP32, conv_impl::FP32, 16, ISA_AVX512>(dc);
     } else
       el_error("TODO: FP16 UserTypes for DIRECT_VMG.");
 
-  } else if (algorithm == CONV_DIRECT_1X1) {
-    if (dims.kh != 1 || dims.kw != 1) {
-      el_error("Algorithm CONV_DIRECT_1X1 not supported for this shape.");
-      return ELD_GENERAL_ERROR;
-    }
+  } else if (dc.algorithm == CONV_DIRECT_1X1) {
     if (user_type == user_type_f32) {
-      if (f16c_opt)
-        xc = new elx_conv_direct_1x1_t<conv::FP32, conv_impl::FP32_F16w, 16, ISA_AVX512>(*this);
+      if (dc.f16c_opt)
+        xc = new elx_conv_direct_1x1_t<conv::FP32, conv_impl::FP32_F16w, 16, ISA_AVX512>(dc);
       else
-        xc = new elx_conv_direct_1x1_t<conv::FP32, conv_impl::FP32, 16, ISA_AVX512>(*this);
+        xc = new elx_conv_direct_1x1_t<conv::FP32, conv_impl::FP32, 16, ISA_AVX512>(dc);
     } else if (user_type == user_type_u8f32u8f32) {
-        xc = new elx_int8_conv_direct_1x1_t<conv::U8F32U8F32, conv_impl::INT8_F32, 16, ISA_AVX512>(*this);
+        xc = new elx_int8_conv_direct_1x1_t<conv::U8F32U8F32, conv_impl::INT8_F32, 16, ISA_AVX512>(dc);
     } else if (user_type == user_type_u8f32s8f32) {
-        xc = new elx_int8_conv_direct_1x1_t<conv::U8F32S8F32, conv_impl::INT8_F32, 16, ISA_AVX512>(*this);
+        xc = new elx_int8_conv_direct_1x1_t<conv::U8F32S8F32, conv_impl::INT8_F32, 16, ISA_AVX512>(dc);
     } else
       el_error("TODO: FP16 UserTypes for DIRECT 1x1.");
-  } else if (algorithm == CONV_WINOGRAD) {
-    // Winograd
-    if (dilations.h > 1 || dilations.w > 1 ||
-        strides.h != 1 || strides.w != 1 ||
-        dims.kh != 3 || dims.kw != 3) {
-      el_error("Algorithm CONV_WINOGRAD: data shape not supported");
-      return ELD_UNIMPLEMENTED;
-    }
-
-    if ((user_type == user_type_u8f32u8f32 ||
-        user_type == user_type_u8f32s8f32 ||
-        user_type == user_type_u8f32f32f32) &&
-        input_quant.z != 0) {
-      el_error("Support abs-max scaling for input only in Conv Winograd ...");
-    }
-
-    if (tile_size == 0) {
-      int t = dims.n * ((dims.oh + 3) / 4) * ((dims.ow + 3) / 4);
-      float mac_per_read = (t * ALIGNUP(oc, 16)) * 1.0f / (t + ALIGNUP(oc, V));
-#define MAC_PER_READ_A6_LIMIT (25.0f)
-      tile_size = mac_per_read > MAC_PER_READ_A6_LIMIT  ? 6 : 4;
-    }
-
+  } else if (dc.algorithm == CONV_WINOGRAD) {
 #define create_conv_wino(U, T)                                       \
-  switch (tile_size) {                                               \
-  case 4:                                                            \
-    xc = new elx_conv_wino_t<U, T, 4, 3, 16, ISA_AVX512>(*this);     \
+  switch (dc.dims.kh * 10 + dc.tile_size) { /* K, A */               \
+  case 34:                                                           \
+    xc = new elx_conv_wino_t<U, T, 4, 3, 16, ISA_AVX512>(dc);        \
+    break;                                                           \
+  case 35:                                                           \
+    xc = new elx_conv_wino_t<U, T, 5, 3, 16, ISA_AVX512>(dc);        \
     break;                                                           \
-  case 5:                                                            \
-    xc = new elx_conv_wino_t<U, T, 5, 3, 16, ISA_AVX512>(*this);     \
+  case 36:                                                           \
+    xc = new elx_conv_wino_t<U, T, 6, 3, 16, ISA_AVX512>(dc);        \
     break;                                                           \
-  case 6:                                                            \
-    xc = new elx_conv_wino_t<U, T, 6, 3, 16, ISA_AVX512>(*this);     \
+  case 37:                                                           \
+    xc = new elx_conv_wino_t<U, T, 7, 3, 16, ISA_AVX512>(dc);        \
     break;                                                           \
-  case 7:                                                            \
-    xc = new elx_conv_wino_t<U, T, 7, 3, 16, ISA_AVX512>(*this);     \
+  case 38:                                                           \
+    xc = new elx_conv_wino_t<U, T, 8, 3, 16, ISA_AVX512>(dc);        \
+    break;                                                           \
+  case 56:                                                           \
+    xc = new elx_conv_wino_t<U, T, 6, 5, 16, ISA_AVX512>(dc);        \
+    break;                                                           \
+  case 58:                                                           \
+    xc = new elx_conv_wino_t<U, T, 8, 5, 16, ISA_AVX512>(dc);        \
+    break;                                                           \
+  case 78:                                                           \
+    xc = new elx_conv_wino_t<U, T, 8, 7, 16, ISA_AVX512>(dc);        \
     break;                                                           \
   default:                                                           \
     el_error("Unimplemented tile size");                             \
@@ -255,23 +437,21 @@ int eld_conv_t::setup(bool fully_setup)
   }
 
 #define create_int8_conv_wino(U, T)                                       \
-  switch (tile_size) {                                                    \
+  switch (dc.tile_size) {                                                 \
   case 4:                                                                 \
-    xc = new elx_int8_conv_wino_t<U, T, 4, 3, 16, ISA_AVX512>(*this);     \
+    xc = new elx_int8_conv_wino_t<U, T, 4, 3, 16, ISA_AVX512>(dc);        \
     break;                                                                \
   case 5:                                                                 \
-    xc = new elx_int8_conv_wino_t<U, T, 5, 3, 16, ISA_AVX512>(*this);     \
+    xc = new elx_int8_conv_wino_t<U, T, 5, 3, 16, ISA_AVX512>(dc);        \
     break;                                                                \
   case 6:                                                                 \
-    xc = new elx_int8_conv_wino_t<U, T, 6, 3, 16, ISA_AVX512>(*this);     \
+    xc = new elx_int8_conv_wino_t<U, T, 6, 3, 16, ISA_AVX512>(dc);        \
     break;                                                                \
   default:                                                                \
     el_error("Unimplemented tile size");                                  \
     break;                                                                \
   }
 
-    if (!disable_autoparam) f16c_opt = true;
-
     // User int8
     if (user_type == user_type_u8f32u8f32) {
       create_int8_conv_wino(conv::U8F32U8F32, conv_impl::INT8_F32);
@@ -281,9 +461,9 @@ int eld_conv_t::setup(bool fully_setup)
       create_int8_conv_wino(conv::U8F32F32F32, conv_impl::INT8_F32);
     } else {
       // User fp32
-      if ((execution_mode & 0xF00) != 0x100) {
+      if ((dc.execution_mode & 0xF00) != 0x100) {
         // Impl. fp32
-        if (f16c_opt && user_type == user_type_f32) {
+        if (dc.f16c_opt && user_type == user_type_f32) {
           create_conv_wino(conv::FP32, conv_impl::FP32_F16iwo);
 #ifdef ENABLE_USER_FP16
         } else if (user_type == user_type_f16) {
@@ -294,7 +474,7 @@ int eld_conv_t::setup(bool fully_setup)
         }
       } else {
         // Impl. int8
-        if (f16c_opt && user_type == user_type_f32) {
+        if (dc.f16c_opt && user_type == user_type_f32) {
           create_int8_conv_wino(conv::FP32, conv_impl::INT8_F16o);
 #ifdef ENABLE_USER_FP16
         } else if (user_type == user_type_f16) {
@@ -305,14 +485,14 @@ int eld_conv_t::setup(bool fully_setup)
         }
       }
     }
-  } else if (algorithm == DECONV_DIRECT) {
+  } else if (dc.algorithm == DECONV_DIRECT) {
     if (user_type == user_type_f32) {
-      xc = new elx_deconv_direct_t<conv::FP32, conv_impl::FP32, 16, ISA_AVX512>(*this);
+      xc = new elx_deconv_direct_t<conv::FP32, conv_impl::FP32, 16, ISA_AVX512>(dc);
     } else
       el_error("TODO: FP16 UserTypes for DECONV_DIRECT.");
   }
 
-  return ELD_OK;
+  return xc;
 }
 
 }  // namespace euler
@@ -0,0 +1,117 @@
+#include <algorithm>
+#include "euler.hpp"
+#include "el_def.hpp"
+#include "el_utils.hpp"
+#include "elx_conv.hpp"
+
+namespace euler {
+
+// Greedy-by-size offset assignment: largest buffer first, each placed at
+// the lowest page aligned gap not used by an already placed buffer whose
+// live range [first, last] overlaps.
+struct arena_buffer_t {
+  int idx;
+  size_t size;
+  int first, last;
+};
+
+static size_t arena_place(std::vector<arena_buffer_t> &bufs,
+                          std::vector<size_t> &offsets)
+{
+  std::stable_sort(bufs.begin(), bufs.end(),
+                   [](const arena_buffer_t &a, const arena_buffer_t &b) {
+                     return a.size > b.size;
+                   });
+
+  size_t peak = 0;
+  std::vector<const arena_buffer_t *> placed;
+  std::vector<std::pair<size_t, size_t>> used; // [begin, end)
+  for (auto &b : bufs) {
+    used.clear();
+    for (auto p : placed) {
+      if (p->first <= b.last && b.first <= p->last)
+        used.emplace_back(offsets[p->idx], offsets[p->idx] + p->size);
+    }
+    std::sort(used.begin(), used.end());
+
+    size_t offset = 0;
+    for (auto &u : used) {
+      if (u.first >= offset + b.size)
+        break;
+      offset = std::max(offset, alignup(u.second, PAGE_SIZE));
+    }
+    offsets[b.idx] = offset;
+    peak = std::max(peak, offset + b.size);
+    placed.push_back(&b);
+  }
+  return peak;
+}
+
+int eld_conv_arena_plan(eld_conv_arena_t &arena, eld_conv_t *convs[],
+                        int nconvs, int inflight)
+{
+  if (nconvs < 0 || inflight < 1) {
+    el_error("Arena plan: invalid parameters");
+    return ELD_GENERAL_ERROR;
+  }
+  for (auto i = 0; i < nconvs; ++i) {
+    if (convs[i] == nullptr || convs[i]->xc == nullptr) {
+      el_error("Arena plan: convolution not fully setup");
+      return ELD_GENERAL_ERROR;
+    }
+  }
+
+  arena.scratch_offset.assign(nconvs, 0);
+  arena.workspace_offset.assign(nconvs, 0);
+  arena.scratch_size = 0;
+  arena.workspace_size = 0;
+
+  // Scratch is live while the layer executes, overlapping the layers
+  // in flight with it. Workspace persists for all layers.
+  std::vector<arena_buffer_t> scratch, workspace;
+  size_t scratch_total = 0;
+  for (auto i = 0; i < nconvs; ++i) {
+    size_t ssz = alignup(convs[i]->byte_sizes.scratch, PAGE_SIZE);
+    size_t wsz = alignup(convs[i]->byte_sizes.workspace, PAGE_SIZE);
+    if (ssz > 0)
+      scratch.push_back({ i, ssz, i - inflight + 1, i + inflight - 1 });
+    if (wsz > 0)
+      workspace.push_back({ i, wsz, 0, nconvs });
+    scratch_total += ssz;
+  }
+
+  arena.scratch_size = arena_place(scratch, arena.scratch_offset);
+  arena.workspace_size = arena_place(workspace, arena.workspace_offset);
+
+  el_log(__INFO, "Arena plan: %d layers, inflight=%d, scratch %zu/%zu bytes,"
+         " workspace %zu bytes", nconvs, inflight, arena.scratch_size,
+         scratch_total, arena.workspace_size);
+  return ELD_OK;
+}
+
+int eld_conv_arena_bind(const eld_conv_arena_t &arena, eld_conv_t *convs[],
+                        int nconvs, void *scratch, void *workspace)
+{
+  if (nconvs != (int)arena.scratch_offset.size()
+      || nconvs != (int)arena.workspace_offset.size()
+      || (arena.scratch_size > 0 && scratch == nullptr)
+      || (arena.workspace_size > 0 && workspace == nullptr)) {
+    el_error("Arena bind: invalid parameters");
+    return ELD_GENERAL_ERROR;
+  }
+
+  for (auto i = 0; i < nconvs; ++i) {
+    auto &c = *convs[i];
+    if (c.byte_sizes.scratch > 0) {
+      c.scratch_pad = (char *)scratch + arena.scratch_offset[i];
+      c.use_scratch_pad = true;
+    }
+    if (c.byte_sizes.workspace > 0) {
+      c.workspace_pad = (char *)workspace + arena.workspace_offset[i];
+      c.use_workspace_pad = true;
+    }
+  }
+  return ELD_OK;
+}
+
+}  // namespace euler
@@ -0,0 +1,561 @@
+#include <float.h>
+#include <string.h>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <tuple>
+#include "euler.hpp"
+#include "el_def.hpp"
+#include "el_intrin.hpp"
+#include "el_utils.hpp"
+#include "el_stl.hpp"
+#include "el_parallel.hpp"
+#include "elx_conv.hpp"
+#include "elx_conv_cost.hpp"
+#include "elx_post_ops.hpp"
+
+namespace euler {
+
+// Depth-first execution of a conv chain
+//
+// Output rows of the last layer are split in bands. Walking the chain
+// backwards, a band of output rows [a, b) of a layer needs its input rows
+// [a * hs - t, (b - 1) * hs - t + (kh - 1) * hd + 1), clipped to the
+// tensor with the clipped part turned into band pads. Every layer runs on
+// a band descriptor of that shape (n = 1), shared by bands of equal shape,
+// producing the next layer's input band in a small buffer. Rows of the
+// first input and the last output are gathered/scattered per plane, or
+// aliased in place when an image is a single plane (nhwc).
+//
+// A pooling post-op of the last layer makes bands of pooled rows, whose
+// windows take the last layer's output rows. That band, rather than the
+// full resolution output, is reduced into the chain output while in cache.
+// A convolution with a pooling post-op runs as a chain of one layer.
+//
+// With thread bands, every thread of the team runs whole bands through the
+// chain on its own single-threaded band descriptors and buffers, bands
+// sized to its own L2: a depthwise band feeds the next 1x1 GEMM while in
+// the core's cache. Band descriptors of a layer and band shape share one
+// inference workspace of transformed weights across threads. Layers too thin to split across a team (int8
+// depthwise -> 1x1, MobileNet blocks) are run this way by default.
+
+struct chain_band_t {
+  // Per layer input rows [r0, r1), rows[k] = last layer output rows
+  std::vector<std::pair<int, int>> rows;
+  // Band descriptors [slot][layer], slot: thread with thread bands
+  std::vector<std::vector<eld_conv_t *>> desc;
+  // Chain output rows, pooled
+  std::pair<int, int> pooled;
+};
+
+// Pooling of the last layer output, f32 planes x rows x ow x lanes
+struct chain_pool_t {
+  int kind, kh, kw, sh, sw, t, l;
+  int oh, ow, ph, pw, lanes;
+};
+
+// Image of a tensor as planes of rows
+struct chain_layout_t {
+  int planes;
+  size_t row_bytes;
+  size_t image_bytes;
+};
+
+struct elx_conv_chain_t {
+  ~elx_conv_chain_t() {
+    for (auto p : bufs)
+      ::free(p);
+    for (auto p : scratch)
+      ::free(p);
+  }
+
+  // Band buffer j of slot: layer outputs but the last, chain input band
+  // (j = k - 1), chain output band (j = k)
+  inline void *buf(int slot, int j) {
+    return bufs[slot * (convs.size() + 1) + j];
+  }
+
+  std::vector<eld_conv_t *> convs;
+  // Band descriptors by slot, layer, ih, oh, t, b
+  std::map<std::tuple<int, int, int, int, int, int>,
+           std::unique_ptr<eld_conv_t>> descs;
+  std::vector<chain_band_t> bands;
+  chain_layout_t in, out;
+  bool with_pool;
+  chain_pool_t pool;
+  // Slots of band descriptors and buffers: team size with thread bands,
+  // else 1
+  int nslots;
+  std::vector<void *> bufs;
+  // Scratch pads of single-threaded band descriptors
+  std::vector<void *> scratch;
+};
+
+static chain_layout_t chain_layout(int fmt, int c, int h, size_t bytes, int n)
+{
+  chain_layout_t l;
+  l.image_bytes = bytes / n;
+  if (fmt == nhwc)
+    l.planes = 1;
+  else if (fmt == nChw16c)
+    l.planes = ALIGNUP(c, 16) / 16;
+  else if (fmt == nChw8c)
+    l.planes = ALIGNUP(c, 8) / 8;
+  else
+    l.planes = c;
+  l.row_bytes = l.image_bytes / l.planes / h;
+  return l;
+}
+
+// Input rows of output rows [a, b) of layer, unclipped
+static inline std::pair<int, int> chain_input_rows(const eld_conv_t &c,
+                                                   int a, int b)
+{
+  return { a * c.strides.h - c.pads.t,
+           (b - 1) * c.strides.h - c.pads.t
+               + (c.dims.kh - 1) * c.dilations.h + 1 };
+}
+
+static void chain_band_rows(const elx_conv_chain_t &x, int a, int b,
+                            std::vector<std::pair<int, int>> &rows)
+{
+  int k = x.convs.size();
+  rows.resize(k + 1);
+  rows[k] = { a, b };
+  if (x.with_pool) {
+    auto &p = x.pool;
+    rows[k] = { estl::max(a * p.sh - p.t, 0),
+                estl::min((b - 1) * p.sh - p.t + p.kh, p.oh) };
+  }
+  for (int j = k - 1; j >= 0; --j) {
+    auto r = chain_input_rows(*x.convs[j], rows[j + 1].first,
+                              rows[j + 1].second);
+    rows[j] = { estl::max(r.first, 0),
+                estl::min(r.second, x.convs[j]->dims.ih) };
+  }
+}
+
+static eld_conv_t *chain_band_desc(elx_conv_chain_t &x, int slot, int j,
+                                   const std::pair<int, int> &in_rows,
+                                   const std::pair<int, int> &out_rows)
+{
+  const eld_conv_t &s = *x.convs[j];
+  auto r = chain_input_rows(s, out_rows.first, out_rows.second);
+  int ih = in_rows.second - in_rows.first;
+  int oh = out_rows.second - out_rows.first;
+  int t = in_rows.first - r.first;
+  int b = r.second - in_rows.second;
+
+  auto key = std::make_tuple(slot, j, ih, oh, t, b);
+  auto it = x.descs.find(key);
+  if (it != x.descs.end())
+    return it->second.get();
+
+  std::unique_ptr<eld_conv_t> d(new eld_conv_t);
+  conv_desc_clone(*d, s);
+  d->dims.n = 1;
+  d->dims.ih = ih;
+  d->dims.oh = oh;
+  d->pads = { s.pads.l, s.pads.r, t, b };
+  if (post_ops_pool(d->post_ops) != nullptr)
+    d->post_ops.pop_back();
+  d->nthreads = x.nslots > 1 ? 1 : s.nthreads;
+  d->name = s.name + ".band";
+
+  if (d->setup() != ELD_OK || d->xc == nullptr) {
+    el_error("Conv chain: band descriptor setup failed");
+    return nullptr;
+  }
+  // Slots run concurrently, off the per-thread shared scratch, on one
+  // workspace of transformed weights per layer and band shape
+  if (x.nslots > 1) {
+    char group[128];
+    snprintf(group, sizeof(group), "chain:%p:%d:%d:%d:%d:%d", (void *)&x,
+             j, ih, oh, t, b);
+    d->xc->workspace_group_key_ = group;
+  }
+  if (x.nslots > 1 && d->byte_sizes.scratch > 0) {
+    void *pad;
+    if (memalign64(&pad, d->byte_sizes.scratch) != 0) {
+      el_error("Conv chain: scratch allocation failed");
+      return nullptr;
+    }
+    x.scratch.push_back(pad);
+    d->use_scratch_pad = true;
+    d->scratch_pad = pad;
+  }
+  eld_conv_t *p = d.get();
+  x.descs[key] = std::move(d);
+  return p;
+}
+
+static inline int chain_output_rows(const elx_conv_chain_t &x)
+{
+  return x.with_pool ? x.pool.ph : x.convs.back()->dims.oh;
+}
+
+// Bytes of intermediate band buffers of bands of band_rows output rows,
+// last layer output band included if pooled
+static size_t chain_footprint(const elx_conv_chain_t &x, int band_rows)
+{
+  int k = x.convs.size();
+  int oh = chain_output_rows(x);
+  std::vector<std::pair<int, int>> rows;
+  size_t peak = 0;
+  for (int a = 0; a < oh; a += band_rows) {
+    chain_band_rows(x, a, estl::min(a + band_rows, oh), rows);
+    size_t sz = 0;
+    for (int j = 1; j < k; ++j) {
+      auto &c = *x.convs[j];
+      sz += c.byte_sizes.input / c.dims.n / c.dims.ih
+            * (rows[j].second - rows[j].first);
+    }
+    if (x.with_pool)
+      sz += sizeof(float) * x.out.planes * x.pool.lanes * x.pool.ow
+            * (rows[k].second - rows[k].first);
+    peak = estl::max(peak, sz);
+  }
+  return peak;
+}
+
+// Int8 chain with a depthwise layer: layers too thin to split across a
+// team, run with thread bands by default
+static bool chain_thread_bands(eld_conv_t *convs[], int nconvs)
+{
+  bool depthwise = false;
+  for (int j = 0; j < nconvs; ++j) {
+    auto &c = *convs[j];
+    if (c.data_type.input != u8)
+      return false;
+    depthwise |= c.dims.g > 1 && c.dims.g == c.dims.ic
+        && c.dims.g == c.dims.oc;
+  }
+  return depthwise;
+}
+
+// Bands, band descriptors and buffers of a chain. nthr: team size, slots
+// of thread bands
+static elx_conv_chain_t *chain_create(eld_conv_t *convs[], int nconvs,
+                                      int &band_rows, bool thread_bands,
+                                      int nthr)
+{
+  std::unique_ptr<elx_conv_chain_t> x(new elx_conv_chain_t);
+  x->convs.assign(convs, convs + nconvs);
+  x->nslots = thread_bands ? nthr : 1;
+  auto &first = *convs[0], &last = *convs[nconvs - 1];
+
+  auto pool = post_ops_pool(last.post_ops);
+  x->with_pool = pool != nullptr;
+  int oh = last.dims.oh;
+  if (x->with_pool) {
+    auto &p = pool->pool;
+    auto &xp = x->pool;
+    xp = { pool->kind, p.kh, p.kw, p.sh, p.sw, p.t, p.l,
+           last.dims.oh, last.dims.ow, 0, 0, 0 };
+    post_ops_pool_dims(last, *pool, xp.ph, xp.pw);
+    int fmt = last.formats.output;
+    xp.lanes = fmt == nhwc ? last.dims.oc
+        : fmt == nChw16c ? 16 : fmt == nChw8c ? 8 : 1;
+    oh = xp.ph;
+  }
+
+  x->in = chain_layout(first.formats.input, first.dims.ic, first.dims.ih,
+                       first.byte_sizes.input, first.dims.n);
+  x->out = chain_layout(last.formats.output, last.dims.oc, oh,
+                        last.byte_sizes.output, last.dims.n);
+
+  // Largest band whose intermediates fit half of the team's L2, or with
+  // thread bands half of a core's L2 and enough bands for the team
+  int rows = band_rows;
+  if (rows <= 0) {
+    auto &ci = el_cache_info();
+    size_t budget = thread_bands ? ci.l2 / 2
+                                 : estl::min(ci.l2 * nthr / 2, ci.llc / 2);
+    auto nbands = [&](int r) { return first.dims.n * ((oh + r - 1) / r); };
+    rows = oh;
+    while (rows > 1 && (chain_footprint(*x, rows) > budget
+                        || (thread_bands && nbands(rows) < nthr)))
+      rows = (rows + 1) / 2;
+  }
+  rows = estl::min(estl::max(rows, 1), oh);
+
+  // buf_bytes[0, k-2]: layer outputs, [k-1]: chain input band,
+  // [k]: chain output band
+  std::vector<size_t> buf_bytes(nconvs + 1, 0);
+  for (int a = 0; a < oh; a += rows) {
+    chain_band_t band;
+    band.pooled = { a, estl::min(a + rows, oh) };
+    chain_band_rows(*x, a, band.pooled.second, band.rows);
+    band.desc.resize(x->nslots);
+    for (int slot = 0; slot < x->nslots; ++slot) {
+      for (int j = 0; j < nconvs; ++j) {
+        auto d = chain_band_desc(*x, slot, j, band.rows[j], band.rows[j + 1]);
+        if (d == nullptr)
+          return nullptr;
+        band.desc[slot].push_back(d);
+        if (j == 0)
+          buf_bytes[nconvs - 1] = estl::max(buf_bytes[nconvs - 1],
+                                            d->byte_sizes.input);
+        int o = j == nconvs - 1 ? nconvs : j;
+        buf_bytes[o] = estl::max(buf_bytes[o], d->byte_sizes.output);
+      }
+    }
+    x->bands.push_back(std::move(band));
+  }
+
+  x->bufs.assign(x->nslots * (nconvs + 1), nullptr);
+  for (int slot = 0; slot < x->nslots; ++slot) {
+    for (int j = 0; j <= nconvs; ++j) {
+      if ((j == nconvs - 1 && x->in.planes == 1)
+          || (j == nconvs && x->out.planes == 1 && !x->with_pool))
+        continue;
+      if (memalign64(&x->bufs[slot * (nconvs + 1) + j], buf_bytes[j]) != 0) {
+        el_error("Conv chain: band buffer allocation failed");
+        return nullptr;
+      }
+    }
+  }
+
+  el_log(__INFO, "Conv chain: %d layers%s, %zu bands of %d rows%s, %zu band "
+         "descriptors, intermediates %zu bytes", nconvs,
+         x->with_pool ? " + pooling" : "", x->bands.size(), rows,
+         thread_bands ? " per thread" : "", x->descs.size(),
+         chain_footprint(*x, rows));
+  band_rows = rows;
+  return x.release();
+}
+
+eld_conv_chain_t::eld_conv_chain_t()
+{
+  band_rows = 0;
+  thread_bands = 0;
+  xc = nullptr;
+}
+
+eld_conv_chain_t::~eld_conv_chain_t()
+{
+  delete xc;
+}
+
+int eld_conv_chain_t::setup(eld_conv_t *convs[], int nconvs)
+{
+  delete xc;
+  xc = nullptr;
+
+  if (nconvs < 1) {
+    el_error("Conv chain: empty chain");
+    return ELD_GENERAL_ERROR;
+  }
+  for (int j = 0; j < nconvs; ++j) {
+    auto &c = *convs[j];
+    if (c.xc == nullptr) {
+      el_error("Conv chain: convolution not fully setup");
+      return ELD_GENERAL_ERROR;
+    }
+    if (c.algorithm == DECONV_DIRECT || c.with_op_sum || c.with_argmax
+        || (c.with_ip_sum && j != nconvs - 1)
+        || (post_ops_pool(c.post_ops) != nullptr && j != nconvs - 1)) {
+      el_error("Conv chain: unsupported convolution in chain");
+      return ELD_UNIMPLEMENTED;
+    }
+    if (j == 0)
+      continue;
+    auto &p = *convs[j - 1];
+    if (p.dims.n != c.dims.n || p.dims.oc != c.dims.ic
+        || p.dims.oh != c.dims.ih || p.dims.ow != c.dims.iw
+        || p.formats.output != c.formats.input
+        || p.data_type.output != c.data_type.input) {
+      el_error("Conv chain: output of a layer does not match next input");
+      return ELD_GENERAL_ERROR;
+    }
+  }
+
+  if (thread_bands == 0)
+    thread_bands = chain_thread_bands(convs, nconvs) ? 1 : -1;
+  xc = chain_create(convs, nconvs, band_rows, thread_bands > 0,
+                    convs[nconvs - 1]->xc->ep.nthreads);
+  return xc != nullptr ? ELD_OK : ELD_GENERAL_ERROR;
+}
+
+// Copy rows [r0, r1) of each plane between an image and a band, by mthr
+// threads
+static void chain_copy_rows(int mthr, const chain_layout_t &l, int h, int r0,
+                            int r1, char *image, char *band, bool to_band)
+{
+  size_t bytes = (r1 - r0) * l.row_bytes;
+  estl::parallel_for<1>(mthr, [&](int p) {
+    char *img = image + (p * h + r0) * l.row_bytes;
+    char *bnd = band + p * bytes;
+    if (to_band)
+      memcpy(bnd, img, bytes);
+    else
+      memcpy(img, bnd, bytes);
+  }, l.planes);
+}
+
+// Pool rows [c0, c1) of the last layer output band into rows [a, b) of
+// each plane of an image, by mthr threads
+static void chain_pool_rows(int mthr, const chain_pool_t &p, int planes,
+                            const float *band, int c0, int c1, float *image,
+                            int a, int b)
+{
+  int lanes = p.lanes;
+  size_t band_plane = (size_t)(c1 - c0) * p.ow * lanes;
+  size_t image_plane = (size_t)p.ph * p.pw * lanes;
+  bool is_max = p.kind == POST_OP_MAX_POOL;
+
+  estl::parallel_for<2>(mthr, [&](int _p, int _r) {
+    int r = a + _r;
+    int h0 = estl::max(r * p.sh - p.t, 0);
+    int h1 = estl::min(r * p.sh - p.t + p.kh, p.oh);
+    const float *src = band + _p * band_plane;
+    float *dst = image + _p * image_plane + (size_t)r * p.pw * lanes;
+    iter_each (_q, p.pw) {
+      int w0 = estl::max(_q * p.sw - p.l, 0);
+      int w1 = estl::min(_q * p.sw - p.l + p.kw, p.ow);
+      __m512 scale = _mm512_set1_ps(1.f / ((h1 - h0) * (w1 - w0)));
+      for (int c = 0; c < lanes; c += 16) {
+        __mmask16 k = lanes - c >= 16 ? 0xffff : (1 << (lanes - c)) - 1;
+        __m512 acc = is_max ? _mm512_set1_ps(-FLT_MAX) : _mm512_setzero_ps();
+        for (int h = h0; h < h1; ++h) {
+          const float *s = src + (size_t)(h - c0) * p.ow * lanes + c;
+          for (int w = w0; w < w1; ++w) {
+            __m512 v = _mm512_maskz_loadu_ps(k, s + (size_t)w * lanes);
+            acc = is_max ? _mm512_max_ps(acc, v) : _mm512_add_ps(acc, v);
+          }
+        }
+        if (!is_max)
+          acc = _mm512_mul_ps(acc, scale);
+        _mm512_mask_storeu_ps(dst + (size_t)_q * lanes + c, k, acc);
+      }
+    }
+  }, planes, b - a);
+}
+
+// Band of image n through the chain on descriptors/buffers of slot
+static int chain_execute_band(elx_conv_chain_t *x, const chain_band_t &band,
+                              int slot, int n, void *output, void *input,
+                              void *weights[], void *bias[])
+{
+  int k = x->convs.size();
+  auto &first = *x->convs[0], &last = *x->convs[k - 1];
+  int ih = first.dims.ih, oh = chain_output_rows(*x);
+  char *in_img = (char *)input + n * x->in.image_bytes;
+  char *out_img = (char *)output + n * x->out.image_bytes;
+  void *in_buf = x->buf(slot, k - 1), *out_buf = x->buf(slot, k);
+  // A thread band runs nested in the slots' region, on its thread only:
+  // a nested region of max_concurrency() would skip the others' share
+  int mthr = x->nslots > 1 ? 1 : estl::max_concurrency();
+
+  auto &ir = band.rows[0], &or_ = band.pooled;
+  void *in = x->in.planes == 1
+      ? in_img + ir.first * x->in.row_bytes : in_buf;
+  if (x->in.planes != 1)
+    chain_copy_rows(mthr, x->in, ih, ir.first, ir.second, in_img,
+                    (char *)in_buf, true);
+
+  for (int j = 0; j < k; ++j) {
+    void *out = j < k - 1 ? x->buf(slot, j)
+        : x->out.planes == 1 && !x->with_pool
+        ? out_img + or_.first * x->out.row_bytes
+        : out_buf;
+    if (j == k - 1 && last.with_ip_sum && x->out.planes != 1)
+      chain_copy_rows(mthr, x->out, oh, or_.first, or_.second, out_img,
+                      (char *)out_buf, true);
+    int ret = elx_conv(*band.desc[slot][j], out, in, weights[j],
+                       bias == nullptr ? nullptr : bias[j]);
+    if (ret != ELX_OK)
+      return ret;
+    in = out;
+  }
+
+  if (x->with_pool)
+    chain_pool_rows(mthr, x->pool, x->out.planes, (float *)out_buf,
+                    band.rows[k].first, band.rows[k].second,
+                    (float *)out_img, or_.first, or_.second);
+  else if (x->out.planes != 1)
+    chain_copy_rows(mthr, x->out, oh, or_.first, or_.second, out_img,
+                    (char *)out_buf, false);
+  return ELX_OK;
+}
+
+static int chain_execute(elx_conv_chain_t *x, void *output, void *input,
+                         void *weights[], void *bias[])
+{
+  int nimages = x->convs[0]->dims.n, nbands = x->bands.size();
+
+  if (x->nslots == 1) {
+    for (int n = 0; n < nimages; ++n) {
+      for (auto &band : x->bands) {
+        int ret = chain_execute_band(x, band, 0, n, output, input, weights,
+                                     bias);
+        if (ret != ELX_OK)
+          return ret;
+      }
+    }
+    return ELX_OK;
+  }
+
+  // Thread bands: (image, band) items claimed by the slots
+  std::atomic<int> next(0), ret(ELX_OK);
+  estl::parallel_for<1>(x->nslots, [&](int slot) {
+    for (int i = next++; i < nimages * nbands; i = next++) {
+      int r = chain_execute_band(x, x->bands[i % nbands], slot,
+                                 i / nbands, output, input, weights, bias);
+      if (r != ELX_OK)
+        ret = r;
+    }
+  }, x->nslots);
+  return ret;
+}
+
+int elx_conv_chain(eld_conv_chain_t &chain, void *output, void *input,
+                   void *weights[], void *bias[])
+{
+  elx_conv_chain_t *x = chain.xc;
+  if (x == nullptr || output == nullptr || input == nullptr
+      || weights == nullptr) {
+    el_error("Parameter error. Invalid conv chain data!");
+    return ELX_GENERAL_ERROR;
+  }
+  return chain_execute(x, output, input, weights, bias);
+}
+
+// Convolution with a pooling post-op, as a chain of one layer. Band
+// descriptors fold batch norm and apply the other post-ops.
+struct elx_conv_pool_t : public elx_conv_t {
+  elx_conv_pool_t(eld_conv_t &dc) : elx_conv_t(dc) {
+    delete fold_;
+    fold_ = nullptr;
+    ep.with_bias = dc.with_bias;
+    ep.post_ops.clear();
+    eld_conv_t *convs[] = { &dc };
+    int rows = 0;
+    chain_ = chain_create(convs, 1, rows, false, ep.nthreads);
+  }
+  virtual ~elx_conv_pool_t() {
+    delete chain_;
+  }
+  virtual void execute(void *output, void *input, void *weights,
+                       void *bias) {
+    chain_execute(chain_, output, input, &weights, &bias);
+  }
+
+  elx_conv_chain_t *chain_;
+
+private:
+  virtual void set_workspace_buffers(void *base) {}
+  virtual void set_scratch_buffers(void *base) {}
+};
+
+elx_conv_t *create_elx_conv_pool(eld_conv_t &dc)
+{
+  auto xc = new elx_conv_pool_t(dc);
+  if (xc->chain_ == nullptr) {
+    delete xc;
+    return nullptr;
+  }
+  return xc;
+}
+
+}  // namespace euler
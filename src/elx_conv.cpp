@@ -1,5 +1,6 @@
 #include <assert.h>
 #include <string.h>
+#include <algorithm>
 #include <chrono>
 #include "euler.hpp"
 #include "el_stl.hpp"
@@ -8,6 +9,7 @@
 #include "el_init.hpp"
 #include "el_parallel.hpp"
 #include "elx_conv.hpp"
+#include "elx_post_ops.hpp"
 #include "elx_stream.hpp"
 
 namespace euler {
@@ -46,6 +48,10 @@ elx_conv_t::elx_conv_t(eld_conv_t &dc)
   ep.with_argmax = dc.with_argmax;
   ep.f16c_opt = dc.f16c_opt;
   ep.use_scratch_pad = dc.use_scratch_pad;
+  ep.use_workspace_pad = dc.use_workspace_pad;
+  ep.huge_page = dc.huge_page || ego.huge_page;
+  ep.numa = ego.numa && el_numa_nodes() > 1;
+  ep.tweights_cache = dc.tweights_cache || ego.tweights_cache;
   ep.relu_bound_lower = dc.relu_bound.lower;
   ep.relu_bound_upper = dc.relu_bound.upper;
 
@@ -56,6 +62,7 @@ elx_conv_t::elx_conv_t(eld_conv_t &dc)
     ep.relu_bound_upper_vec[i] = ep.relu_bound_upper;
 
   ep.scratch_pad = dc.scratch_pad;
+  ep.workspace_pad = dc.workspace_pad;
 
   ep.prop_kind = dc.prop_kind;
 
@@ -99,6 +106,10 @@ elx_conv_t::elx_conv_t(eld_conv_t &dc)
     ep.sum_quant_S_vec[i] = ep.sum_quant_S;
   ep.sum_quant_z = dc.sum_quant.z;
   ep.sampling_kind = dc.sampling_kind;
+  post_ops_init(ep, dc);
+  fold_ = post_ops_fold_init(dc);
+  if (fold_ != nullptr)
+    ep.with_bias = true;
 
   ep.ormask = (unsigned int)-1;
   ep.eager_mode = dc.eager_mode;
@@ -117,25 +128,38 @@ elx_conv_t::elx_conv_t(eld_conv_t &dc)
     }
   }
 
-  output_ = nullptr;
-  input_ = nullptr;
-  weights_ = nullptr;
-  bias_ = nullptr;
   workspace_ = nullptr;
+  scratch_ = nullptr;
 
   scratch_size_ = 0;
   workspace_size_ = 0;
   has_scratch_ = false;
-  on_destroy_ = ELX_EVENT_NORMAL;
+  replicate_workspace_ = false;
+  workspace_cached_ = false;
+  stream_ = ep.eager_mode ? nullptr : elx_stream_get(dc.stream_name);
+}
+
+// Caller-owned buffers may be supplied after setup(). Workspace is bound
+// once, on first execution.
+void elx_conv_t::set_user_pads(bool use_scratch_pad, void *scratch_pad,
+                               bool use_workspace_pad, void *workspace_pad) {
+  ep.use_scratch_pad = use_scratch_pad && scratch_pad != nullptr;
+  ep.scratch_pad = scratch_pad;
+  if (workspace_ == nullptr) {
+    ep.use_workspace_pad = use_workspace_pad && workspace_pad != nullptr;
+    ep.workspace_pad = workspace_pad;
+  }
 }
 
 void elx_conv_t::set_workspace_buffers() {
   if (workspace_size_ != 0 && workspace_ == nullptr) {
-    if (ep.shared_workspace_enabled) {
+    if (ep.use_workspace_pad) {
+      workspace_ = ep.workspace_pad;
+    } else if (ep.shared_workspace_enabled) {
       const char *key = ep.shared_workspace_key.c_str();
-      workspace_ = shwalloc::acquire(workspace_size_, key);
+      workspace_ = shwalloc::acquire(workspace_size_, key, ep.huge_page);
     } else {
-      workspace_ = walloc::acquire(workspace_size_);
+      workspace_ = walloc::acquire(workspace_size_, ep.huge_page);
     }
   }
   if (workspace_ != nullptr)
@@ -143,16 +167,102 @@ void elx_conv_t::set_workspace_buffers() {
 }
 
 void elx_conv_t::set_scratch_buffers() {
+  if (ep.use_scratch_pad) {
+    set_scratch_buffers(ep.scratch_pad);
+    return;
+  }
+  // Stream workers may run layers concurrently, no thread local sharing
+  if (!ep.eager_mode) {
+    if (scratch_size_ != 0 && scratch_ == nullptr)
+      memalign64(&scratch_, scratch_size_);
+    set_scratch_buffers(scratch_);
+    return;
+  }
   if (scratch_size_ != 0 && !has_scratch_) {
-    void *scratch = scratch = galloc::acquire(scratch_size_);
+    void *scratch = galloc::acquire(scratch_size_, ep.huge_page, ep.numa);
     if (scratch != nullptr)
       has_scratch_ = true;
   }
   set_scratch_buffers(galloc::get());
 }
 
+void elx_conv_t::replicate_workspace() {
+  if (workspace_ == nullptr || workspace_size_ == 0)
+    return;
+
+  int nnodes = el_numa_nodes();
+  size_t size = workspace_size_;
+  size_t map_size = alignup(size, ep.huge_page ? HUGE_PAGE_SIZE : PAGE_SIZE);
+  if (workspace_node_.empty()) {
+    workspace_node_.resize(nnodes, nullptr);
+    for (auto k = 0; k < nnodes; ++k) {
+      workspace_node_[k] = el_mmap(map_size, ep.huge_page);
+      if (workspace_node_[k] == nullptr) {
+        for (auto p : workspace_node_)
+          if (p != nullptr) munmap(p, map_size);
+        workspace_node_.clear();
+        el_warn("NUMA: workspace replica allocation failed");
+        return;
+      }
+    }
+  }
+
+  // Threads of each node copy an even slice of their node's replica
+  int mthr = ep.nthreads;
+  std::vector<int> thr_node(mthr);
+  estl::parallel_for<1>(mthr, [&](int ithr) {
+    thr_node[ithr] = el_numa_current_node();
+  }, mthr);
+
+  auto copy_slice = [&](int node, int rank, int cnt) {
+    size_t chunk = alignup((size + cnt - 1) / cnt, PAGE_SIZE);
+    size_t start = rank * chunk;
+    if (start < size && workspace_node_[node] != workspace_)
+      memcpy((char *)workspace_node_[node] + start,
+             (char *)workspace_ + start, estl::min(chunk, size - start));
+  };
+  estl::parallel_for<1>(mthr, [&](int ithr) {
+    int node = thr_node[ithr], rank = 0, cnt = 0;
+    for (auto i = 0; i < mthr; ++i) {
+      if (thr_node[i] == node) {
+        if (i < ithr) ++rank;
+        ++cnt;
+      }
+    }
+    copy_slice(node, rank, cnt);
+  }, mthr);
+  for (auto k = 0; k < nnodes; ++k) {
+    if (std::find(thr_node.begin(), thr_node.end(), k) == thr_node.end())
+      copy_slice(k, 0, 1);
+  }
+
+  // Own walloc workspace is superseded by node 0 replica
+  if (!ep.use_workspace_pad && !ep.shared_workspace_enabled
+      && workspace_ != workspace_node_[0]) {
+    walloc::release(workspace_);
+    workspace_ = workspace_node_[0];
+    set_workspace_buffers(workspace_);
+  }
+}
+
 void elx_conv_t::teardown() {
-  if (workspace_ != nullptr && !ep.shared_workspace_enabled) {
+  if (!workspace_node_.empty()) {
+    if (workspace_ == workspace_node_[0])
+      workspace_ = nullptr;
+    size_t map_size = alignup(workspace_size_,
+                              ep.huge_page ? HUGE_PAGE_SIZE : PAGE_SIZE);
+    for (auto p : workspace_node_)
+      munmap(p, map_size);
+    workspace_node_.clear();
+  }
+
+  if (workspace_cached_) {
+    wcache::release(workspace_);
+    workspace_ = nullptr;
+    workspace_cached_ = false;
+  } else if (ep.use_workspace_pad) {
+    workspace_ = nullptr;
+  } else if (workspace_ != nullptr && !ep.shared_workspace_enabled) {
     walloc::release(workspace_);
     workspace_ = nullptr;
   } else {
@@ -163,28 +273,20 @@ void elx_conv_t::teardown() {
 
   if (scratch_size_ > 0 && has_scratch_)
     galloc::release();
+  if (scratch_ != nullptr) {
+    ::free(scratch_);
+    scratch_ = nullptr;
+  }
 }
 
 elx_conv_t::~elx_conv_t() {
   if (ep.eager_mode) {
     teardown();
   } else {
-    // submit an end-of-life request
-    ep.stream_sync = true;
-    if (on_destroy_ == ELX_EVENT_NORMAL)
-      on_destroy_ = ELX_EVENT_TEARDOWN;
-    global_stream.submit(this);
-    global_stream.wait(this);
+    // submit an end-of-life request, chained after the last submission
+    stream_->submit(ELX_TASK_TEARDOWN, this)->wait();
   }
-}
-
-void elx_conv_t::set_user_buffers(
-    void *output, void *input, void *weights, void *bias)
-{
-  output_ = output;
-  input_ = input;
-  weights_ = weights;
-  bias_ = bias;
+  delete fold_;
 }
 
 void elx_conv_t::execute_verbose(void *output, void *input, void *weights,
@@ -210,7 +312,42 @@ void elx_conv_t::execute_verbose(void *output, void *input, void *weights,
          hrc_duration(hrc::now() - start_ts).count());
 }
 
+void elx_conv_t::execute_team(void *output, void *input, void *weights,
+                              void *bias) {
+  estl::team_run(ep.nthreads, [&]() {
+    // Folded weights feed the first-run weights transform only, later
+    // executions run on the cached transform and the folded bias
+    void *w = weights, *b = bias;
+    float *folded = nullptr;
+    if (fold_ != nullptr) {
+      if (!fold_->done)
+        w = folded = post_ops_fold(*fold_, (float *)weights, (float *)bias);
+      b = fold_->bias;
+    }
+    if (ep.with_ip_sum && ep.sum_scale != 1.f && !ep.sum_scale_fused)
+      post_ops_scale_sum(ep, output);
+    if (ego.verbose)
+      execute_verbose(output, input, w, b);
+    else
+      execute(output, input, w, b);
+    if (!ep.post_ops.empty() && !ep.post_ops_fused)
+      post_ops_execute(ep, output);
+    if (folded != nullptr) {
+      ::free(folded);
+      fold_->done = true;
+    }
+  });
+}
+
 int elx_conv(eld_conv_t &desc, void *output, void *input, void *weights, void *bias)
+{
+  elx_event event;
+  return elx_conv_async(desc, output, input, weights, bias, {}, event);
+}
+
+int elx_conv_async(eld_conv_t &desc, void *output, void *input,
+                   void *weights, void *bias,
+                   const std::vector<elx_event> &deps, elx_event &event)
 {
   elx_conv_t *xc = desc.xc;
 
@@ -221,21 +358,48 @@ int elx_conv(eld_conv_t &desc, void *output, void *input, void *weights, void *b
     return ELX_GENERAL_ERROR;
   }
 
-  xc->set_scratch_buffers();
+  elx_pads_t pads = { desc.use_scratch_pad, desc.scratch_pad,
+                      desc.use_workspace_pad, desc.workspace_pad };
 
   if (xc->ep.eager_mode) {
-    if (ego.verbose)
-      xc->execute_verbose(output, input, weights, bias);
-    else
-      xc->execute(output, input, weights, bias);
+    for (auto &d : deps)
+      elx_event_wait(d);
+    xc->set_user_pads(pads.use_scratch_pad, pads.scratch_pad,
+                      pads.use_workspace_pad, pads.workspace_pad);
+    xc->set_scratch_buffers();
+    xc->execute_team(output, input, weights, bias);
+    event = nullptr;
   } else {
-    xc->set_user_buffers(output, input, weights, bias);
-    global_stream.submit(xc);
+    // The worker sets pads and scratch, see elx_stream::worker
+    event = xc->stream_->submit(ELX_TASK_EXECUTE, xc, output, input,
+                                weights, bias, deps, pads);
     if (xc->ep.stream_sync)
-      global_stream.wait(xc);
-    return ELX_OK;
+      event->wait();
+  }
+
+  return ELX_OK;
+}
+
+// Null event: already completed
+int elx_event_wait(const elx_event &event)
+{
+  if (event != nullptr)
+    event->wait();
+  return ELX_OK;
+}
+
+bool elx_event_query(const elx_event &event)
+{
+  return event == nullptr || event->query();
+}
+
+int elx_stream_set_cpus(const std::string &name, const char *cpus)
+{
+  if (cpus == nullptr) {
+    el_error("Parameter error. Invalid CPU list!");
+    return ELX_GENERAL_ERROR;
   }
-  
+  elx_stream_get(name)->set_cpus(cpus);
   return ELX_OK;
 }
 
@@ -1,9 +1,10 @@
 #pragma once
 
-#include <mutex>
+#include <vector>
 #include "euler.hpp"
 #include "el_def.hpp"
 #include "el_allocator.hpp"
+#include "el_numa.hpp"
 
 namespace euler {
 
@@ -14,6 +15,13 @@ namespace euler {
 // wino-gemm toutput : t2, A*A, oc3, O2, T, V
 // wino-gemm tweights: oc3, I3, A*A, O2, I2, V, V
 
+// Post-op fused after bias/sum/relu, per-channel vectors padded to 16
+struct elx_post_op_t {
+  int kind;
+  float alpha, beta;
+  std::vector<float> scale, shift;
+};
+
 struct alignas(64) elx_param_t {
   // dimensions
   int g, ic, oc, ih, iw, oh, ow, n, kh, kw;
@@ -70,6 +78,10 @@ struct alignas(64) elx_param_t {
   bool weights_as_blocked;
   bool output_as_blocked;
   bool use_scratch_pad;
+  bool use_workspace_pad;
+  bool huge_page;
+  bool numa;
+  bool tweights_cache;
 
   // threading
   int nthreads;
@@ -94,6 +106,17 @@ struct alignas(64) elx_param_t {
   float relu_bound_upper;
   sampling_kind_t sampling_kind;
 
+  // Scale of the prior output content in the inplace sum. Engines that
+  // scale it in their sum FMA set sum_scale_fused, else the output is
+  // scaled once before execute()
+  float sum_scale;
+  bool sum_scale_fused;
+  // Post-ops after the fused bias/sum/relu. Engines that apply them with
+  // relu on output store set post_ops_fused, else the output is passed
+  // over once after execute()
+  std::vector<elx_post_op_t> post_ops;
+  bool post_ops_fused;
+
   bool eager_mode;
   bool stream_sync;
 
@@ -102,6 +125,7 @@ struct alignas(64) elx_param_t {
   bool shared_workspace_enabled;
 
   void *scratch_pad;
+  void *workspace_pad;
 
   // Redundant data for performance
   alignas(64) float relu_bound_lower_vec[16];
@@ -109,26 +133,29 @@ struct alignas(64) elx_param_t {
   alignas(64) float sum_quant_S_vec[16];
 };
 
-
-const int ELX_EVENT_NORMAL = 0;
-const int ELX_EVENT_TEARDOWN = 1;
-const int ELX_EVENT_EXIT = 2;
+class elx_stream;
+struct post_ops_fold_t;
 
 struct alignas(64) elx_conv_t {
 public:
   elx_conv_t(eld_conv_t &dc);
 
-  void set_user_buffers(void *output, void *input, void *weights, void *bias);
+  void set_user_pads(bool use_scratch_pad, void *scratch_pad,
+                     bool use_workspace_pad, void *workspace_pad);
   void set_scratch_buffers();
   void set_workspace_buffers();
 
   void execute_verbose(void *output, void *input, void *weights, void *bias);
+  // Execute on a team of ep.nthreads threads
+  void execute_team(void *output, void *input, void *weights, void *bias);
   virtual void execute(void *output, void *input, void *weights, void *bias) = 0;
   virtual ~elx_conv_t();
   void teardown();
-  int on_destroy() { return on_destroy_; }
   template <typename F> void setup_workspace(F func) {
-    if (ep.prop_kind == forward_inference && ep.shared_workspace_enabled) {
+    if (!workspace_group_key_.empty() && workspace_cacheable()) {
+      setup_cached_workspace(func, workspace_group_key_);
+    } else if (ep.prop_kind == forward_inference && ep.shared_workspace_enabled
+        && !ep.use_workspace_pad) {
       const char *key = ep.shared_workspace_key.c_str();
       process_singleton_t process_singleton(key);
       {
@@ -141,16 +168,81 @@ public:
     } else {
       set_workspace_buffers();
       func();
+      if (replicate_workspace_)
+        replicate_workspace();
+    }
+  }
+
+  // Workspace computed from weights alone, e.g. transformed weights, is
+  // shared through wcache by engines with equal workspace_cache_key_ and
+  // weights content. Falls back to setup_workspace(func) when the key is
+  // empty or workspace is user, shared or replicated memory.
+  template <typename F>
+  void setup_workspace(F func, const void *weights, size_t weights_size) {
+    if (workspace_cache_key_.empty() || !workspace_cacheable()) {
+      setup_workspace(func);
+      return;
+    }
+    char hash[40] = "";
+    if (!workspace_cached_)
+      snprintf(hash, sizeof(hash), ":%zu:%016llx", weights_size,
+               (unsigned long long)wcache::hash(weights, weights_size));
+    setup_cached_workspace(func, workspace_cache_key_ + hash, weights,
+                           weights_size);
+  }
+
+  // Inference workspace of engine's own memory, filled once per key
+  inline bool workspace_cacheable() {
+    return ep.prop_kind == forward_inference && !ep.use_workspace_pad
+        && !ep.shared_workspace_enabled && !replicate_workspace_
+        && workspace_size_ != 0
+        && (workspace_ == nullptr || workspace_cached_);
+  }
+  template <typename F>
+  void setup_cached_workspace(F func, const std::string &key,
+                              const void *source = nullptr,
+                              size_t source_size = 0) {
+    if (!workspace_cached_) {
+      workspace_ = wcache::acquire(key, workspace_size_, ep.huge_page,
+          [&](void *base) {
+        set_workspace_buffers(base);
+        func();
+      }, source, source_size);
+      workspace_cached_ = true;
     }
+    set_workspace_buffers(workspace_);
+  }
+
+  // Workspace replica per NUMA node, first touched by threads of the
+  // node. Engines opt in with replicate_workspace_ and read workspace
+  // buffers through numa_local() in parallel regions.
+  void replicate_workspace();
+  template <typename T> inline T *numa_local(T *ptr) {
+    if (workspace_node_.empty())
+      return ptr;
+    size_t offset = (char *)ptr - (char *)workspace_;
+    return (T *)((char *)workspace_node_[el_numa_current_node()] + offset);
   }
 
   elx_param_t ep;
 
-  void *workspace_, *output_, *input_, *weights_, *bias_;
+  void *workspace_, *scratch_;
   size_t scratch_size_, workspace_size_;
-  int on_destroy_;
   bool has_scratch_;
-  std::mutex mu_;
+  // Non-eager mode: stream submitted to, own scratch_ buffer
+  elx_stream *stream_;
+  // Non-eager mode: event of the last submission, next one waits on it
+  elx_event last_event_;
+  bool replicate_workspace_;
+  std::vector<void *> workspace_node_;
+  // Layout key of a weights-only workspace, "" if not shareable
+  std::string workspace_cache_key_;
+  // Engines of one group key share a workspace, whatever their weights:
+  // band descriptors of a chain layer and band shape, one per thread
+  std::string workspace_group_key_;
+  bool workspace_cached_;
+  // Batch norm/scale_shift folded into weights and bias, or nullptr
+  post_ops_fold_t *fold_;
 
   inline bool last_I2(int _I2, int _I3, int _I4) {
     return _I4 == ep.I4 - 1 && _I3 == ep.I3 - 1 && _I2 == ep.I2 - 1;
@@ -161,4 +253,25 @@ private:
   virtual void set_scratch_buffers(void *base) = 0;
 };
 
+// Winograd F(A - K + 1, K) has an fp32 engine instance
+static inline bool elx_conv_wino_supported(int A, int K) {
+  switch (K) {
+  case 3: return A >= 4 && A <= 8;
+  case 5: return A == 6 || A == 8;
+  case 7: return A == 8;
+  default: return false;
+  }
+}
+
+// Copy shape and options of s to d, for internal sub-descriptors
+void conv_desc_clone(eld_conv_t &d, const eld_conv_t &s);
+// Instantiate the execution engine for a set-up descriptor
+elx_conv_t *create_elx_conv(eld_conv_t &dc);
+// Band-wise execution of a descriptor with a pooling post-op, see
+// eld_conv_chain.cpp
+elx_conv_t *create_elx_conv_pool(eld_conv_t &dc);
+// Dilated 3x3 Winograd by polyphase decomposition, see
+// elx_conv_polyphase.hpp
+elx_conv_t *create_elx_conv_polyphase(eld_conv_t &dc);
+
 }  // namespace euler
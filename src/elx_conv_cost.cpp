@@ -0,0 +1,785 @@
+#include <stdio.h>
+#include <float.h>
+#include <math.h>
+#include <vector>
+#include "el_def.hpp"
+#include "el_utils.hpp"
+#include "el_stl.hpp"
+#include "el_parallel.hpp"
+#include "elx_conv_cost.hpp"
+#include "elx_conv.hpp"
+#include "elx_conv_polyphase.hpp"
+#include "kernel/elk_def.hpp"
+
+namespace euler {
+
+// Per core machine constants (AVX512, 2 FMA ports)
+#define COST_FLOPS_PER_CYCLE      (64.0f) // 2 ports * 16 lanes * FMA
+#define COST_INT8_SPEEDUP         (2.0f)  // u8s8 madd vs fp32 FMA
+#define COST_TRANS_EFFICIENCY     (0.5f)  // add/sub chains, no FMA pairing
+#define COST_L2_BYTES_PER_CYCLE   (48.0f)
+#define COST_LLC_BYTES_PER_CYCLE  (16.0f)
+#define COST_MEM_BYTES_PER_CYCLE  (6.0f)
+#define COST_SYNC_CYCLES          (2000.0f) // per parallel region/barrier
+// Switching algorithm needs a clear win, model error is larger than this
+#define COST_SELECT_MARGIN        (0.05f)
+
+static const int V = 16;
+
+static size_t read_cache_size(int index, int &level) {
+  char path[128], buf[32];
+  size_t size = 0;
+  level = 0;
+
+  snprintf(path, sizeof(path),
+           "/sys/devices/system/cpu/cpu0/cache/index%d/type", index);
+  FILE *fp = fopen(path, "r");
+  if (fp == nullptr)
+    return 0;
+  bool is_inst = fscanf(fp, "%31s", buf) == 1 && buf[0] == 'I';
+  fclose(fp);
+  if (is_inst)
+    return 0;
+
+  snprintf(path, sizeof(path),
+           "/sys/devices/system/cpu/cpu0/cache/index%d/level", index);
+  if ((fp = fopen(path, "r")) == nullptr)
+    return 0;
+  if (fscanf(fp, "%d", &level) != 1)
+    level = 0;
+  fclose(fp);
+
+  snprintf(path, sizeof(path),
+           "/sys/devices/system/cpu/cpu0/cache/index%d/size", index);
+  if ((fp = fopen(path, "r")) == nullptr)
+    return 0;
+  char unit = 'B';
+  unsigned long v = 0;
+  if (fscanf(fp, "%lu%c", &v, &unit) >= 1) {
+    size = v;
+    if (unit == 'K') size *= 1024;
+    else if (unit == 'M') size *= 1024 * 1024;
+  }
+  fclose(fp);
+  return size;
+}
+
+const el_cache_info_t &el_cache_info() {
+  static el_cache_info_t info = []() {
+    el_cache_info_t ci = { 32 * 1024, 1024 * 1024, 32 * 1024 * 1024 };
+    for (int i = 0; i < 8; ++i) {
+      int level;
+      size_t sz = read_cache_size(i, level);
+      if (sz == 0) continue;
+      if (level == 1) ci.l1 = sz;
+      else if (level == 2) ci.l2 = sz;
+      else if (level == 3) ci.llc = sz;
+    }
+    el_log(__DEBUG, "cost: cache: l1=%zu, l2=%zu, llc=%zu",
+           ci.l1, ci.l2, ci.llc);
+    return ci;
+  }();
+  return info;
+}
+
+conv_cost_shape_t conv_cost_shape(const eld_conv_t &desc) {
+  conv_cost_shape_t s;
+  s.n = desc.dims.n; s.g = desc.dims.g;
+  s.ic = desc.dims.ic; s.oc = desc.dims.oc;
+  s.ih = desc.dims.ih; s.iw = desc.dims.iw;
+  s.oh = desc.dims.oh; s.ow = desc.dims.ow;
+  s.kh = desc.dims.kh; s.kw = desc.dims.kw;
+  s.lp = desc.pads.l; s.rp = desc.pads.r;
+  s.tp = desc.pads.t; s.bp = desc.pads.b;
+  s.hs = desc.strides.h; s.ws = desc.strides.w;
+  s.hd = desc.dilations.h; s.wd = desc.dilations.w;
+  s.input_fmt = desc.formats.input;
+  s.weights_fmt = desc.formats.weights;
+  s.output_fmt = desc.formats.output;
+  s.input_dt = desc.data_type.input;
+  s.weights_dt = desc.data_type.weights;
+  s.output_dt = desc.data_type.output;
+  s.with_relu = desc.with_relu;
+  s.with_ip_sum = desc.with_ip_sum;
+  s.f16c_opt = desc.f16c_opt;
+  s.autoparam = !desc.disable_autoparam;
+  s.input_quant_z = desc.input_quant.z != 0;
+  s.calibrated = desc.sampling_kind == CALIBRATED;
+  s.O = desc.flatting.o; s.T = desc.flatting.t;
+  s.I4 = desc.partition.i; s.O4 = desc.partition.o;
+
+  // Resolved like elx_conv_t
+  int mthr = estl::max_concurrency();
+  s.nthreads = desc.nthreads;
+  if (s.nthreads == 0 || s.nthreads > mthr)
+    s.nthreads = mthr;
+  return s;
+}
+
+static inline bool is_fp32(const conv_cost_shape_t &s) {
+  return s.input_dt == f32 && s.weights_dt == f32 && s.output_dt == f32;
+}
+
+static inline bool is_int8(const conv_cost_shape_t &s) {
+  return s.input_dt == u8 && s.weights_dt == f32
+      && estl::any_of(s.output_dt, u8, s8, f32);
+}
+
+static inline float divup(float a, float b) {
+  return ceilf(a / b);
+}
+
+// f16 operands converted in kernel
+enum { CVT_NONE = 0, CVT_W, CVT_IW };
+
+// FMA port utilization of an O x T register blocked kernel. Each V step
+// issues O*T FMAs against O weight loads and T (fused) broadcasts, plus
+// a vcvtph2ps on an FMA port per f16 operand, and needs >= 8 independent
+// accumulators to hide FMA latency.
+static inline float kernel_eff(int O, int T, int cvt) {
+  float fma = O * T;
+  float cvt_ops = cvt == CVT_IW ? O + T : cvt == CVT_W ? O : 0;
+  return fma / estl::max(fma + cvt_ops, (float)(O + T))
+      * estl::min(1.0f, fma / 8.0f);
+}
+
+// Average efficiency over w points blocked by T with a Tr tail
+static inline float row_eff(int O, int T, int w, int cvt) {
+  int nT = w / T, Tr = w % T;
+  float c = nT * T / kernel_eff(O, T, cvt)
+      + (Tr ? Tr / kernel_eff(O, Tr, cvt) : 0.0f);
+  return w / c;
+}
+
+struct kernel_plan_t {
+  int O, T;
+  float eff;
+};
+
+// Best (O, T) for w points on a row. conv: direct conv kernel, else gemm
+// kernel. T >= lp and Tr >= rp as required by direct engines; with
+// no_tail, T must divide w. User flatting/partition pins O, T and O4.
+static kernel_plan_t best_kernel(const conv_cost_shape_t &s, bool conv,
+                                 int oc2, int w, int cvt, int lp = 0,
+                                 int rp = 0, bool no_tail = false) {
+  kernel_plan_t best = { 0, 0, 0.0f };
+  int max_O = conv ? kconv_max_O : (int)estl::size(kgemm_max_T);
+  for (int O = 1; O <= max_O; ++O) {
+    if (oc2 % (O * estl::max(1, s.O4)) != 0 || (s.O && O != s.O))
+      continue;
+    int max_T = conv ? kconv_max_T : kgemm_max_T[O - 1];
+    int T_hi = s.T ? s.T : estl::min(max_T, w);
+    int T_lo = s.T ? s.T : estl::max(1, lp);
+    if (T_hi > max_T || T_lo < lp) continue;
+    for (int T = T_hi; T >= T_lo; --T) {
+      int Tr = w % T ? w % T : T;
+      if (Tr < rp || (no_tail && w % T != 0)) continue;
+      float eff = row_eff(O, T, w, cvt);
+      if (eff > best.eff) best = { O, T, eff };
+    }
+  }
+  return best;
+}
+
+static inline float balance(float tasks, int nthreads) {
+  if (tasks <= 0.0f) return 1.0f;
+  return tasks / (divup(tasks, nthreads) * nthreads);
+}
+
+// Smallest divisor d of n with size / d <= limit, or n
+static inline int split_to_fit(int n, float size, float limit) {
+  for (int d = 1; d <= n; ++d)
+    if (n % d == 0 && size / d <= limit) return d;
+  return n;
+}
+
+// Bytes moved per cache level, per thread. A stream is served by the
+// smallest level holding its reuse working set; shared (read-only)
+// working sets count once against the LLC, private ones per thread.
+struct cost_traffic_t {
+  const el_cache_info_t &ci;
+  int nthreads;
+  float l2 = 0.0f, llc = 0.0f, mem = 0.0f;
+
+  cost_traffic_t(int nthr) : ci(el_cache_info()), nthreads(nthr) {}
+
+  void add(float bytes, float ws, bool shared) {
+    float llc_ws = shared ? ws : ws * nthreads;
+    bytes /= nthreads;
+    if (ws <= ci.l1 / 2) return; // in kernel efficiency
+    else if (ws <= ci.l2 / 2) l2 += bytes;
+    else if (llc_ws <= ci.llc / 2) llc += bytes;
+    else mem += bytes;
+  }
+
+  // Scratch footprint (tinput/toutput...) beyond half of the LLC is
+  // written back to memory once per run
+  void add_scratch(float bytes) {
+    if (bytes > ci.llc / 2)
+      mem += (bytes - ci.llc / 2) / nthreads;
+  }
+
+  // Compulsory traffic of user tensors
+  void add_tensor(float bytes) {
+    bytes /= nthreads;
+    if (bytes * nthreads <= ci.llc / 2) llc += bytes;
+    else mem += bytes;
+  }
+
+  // Per busy thread, bal of nthreads busy
+  float cycles(float bal) const {
+    return estl::max(l2 / COST_L2_BYTES_PER_CYCLE,
+        estl::max(llc / COST_LLC_BYTES_PER_CYCLE,
+                  mem / COST_MEM_BYTES_PER_CYCLE)) / bal;
+  }
+};
+
+static inline float compute_cycles(float flops, float eff, float bal,
+                                   int nthreads, bool int8) {
+  float peak = COST_FLOPS_PER_CYCLE * (int8 ? COST_INT8_SPEEDUP : 1.0f);
+  return flops / nthreads / (peak * eff * bal);
+}
+
+static inline float trans_cycles(float flops, int nthreads) {
+  return flops / nthreads / (COST_FLOPS_PER_CYCLE * COST_TRANS_EFFICIENCY);
+}
+
+// Direct: c060/c070/a060, int8 c160/a160
+static float cost_direct(const conv_cost_shape_t &s, int xopt) {
+  bool int8 = is_int8(s);
+  if (!is_fp32(s) && !(int8 && s.calibrated))
+    return FLT_MAX;
+  if (s.hd != 1 || s.wd != 1)
+    return FLT_MAX;
+
+  int icg = s.ic / s.g, ocg = s.oc / s.g;
+  bool depthwise = s.g == s.ic && s.g == s.oc;
+  bool conv_kernel = estl::any_of(xopt, 0xc060, 0xc070, 0xc160);
+  bool io_nhwc = s.input_fmt == nhwc && s.output_fmt == nhwc;
+
+  if (int8) {
+    // depthwise has its own engine with c160 only
+    if (!estl::any_of(xopt, 0xc160, 0xa160) || (s.g > 1 && !depthwise))
+      return FLT_MAX;
+    if (depthwise && (xopt != 0xc160 || s.output_dt == f32
+        || s.kh != 3 || s.kw != 3 || s.hs > 2 || s.ws > 2
+        || s.lp > 1 || s.rp > 1 || s.tp > 1 || s.bp > 1
+        || !estl::any_of(s.weights_fmt, ghwio, goihw)
+        || !estl::any_of(s.input_fmt, nchw, nChw16c)
+        || !estl::any_of(s.output_fmt, nchw, nChw16c)))
+      return FLT_MAX;
+    // xopt is picked by kw in int8 direct
+    if (!depthwise && (xopt == 0xc160) != estl::any_of(s.kw, 3, 5, 7))
+      return FLT_MAX;
+    if (!depthwise && (s.weights_fmt != OIhw16i16o
+        || !estl::any_of(s.input_fmt, nChw16c, nhwc)
+        || !estl::any_of(s.output_fmt, nChw16c, nhwc)))
+      return FLT_MAX;
+  } else {
+    if (!estl::any_of(xopt, 0xc060, 0xc070, 0xa060))
+      return FLT_MAX;
+    if (s.g > 1) {
+      if ((icg % V != 0 || ocg % V != 0) && !io_nhwc)
+        return FLT_MAX;
+      if (xopt == 0xc070)
+        return FLT_MAX;
+    }
+    bool format_ok =
+        estl::any_of(s.weights_fmt, hwio, ghwio, OIhw16i16o, gOIhw16i16o)
+        && (io_nhwc
+            || (xopt == 0xc060 && estl::any_of(s.input_fmt, nchw, nChw16c)
+                && s.output_fmt == nChw16c)
+            || (xopt != 0xc060 && s.input_fmt == nChw16c
+                && s.output_fmt == nChw16c));
+    if (!format_ok)
+      return FLT_MAX;
+    if (s.g == 1 && s.ic < V
+        && (s.input_fmt != nchw || s.weights_fmt != hwio || xopt != 0xc060))
+      return FLT_MAX;
+    if (s.with_ip_sum && s.with_relu && s.output_fmt != nChw16c)
+      return FLT_MAX;
+  }
+
+  if (conv_kernel) {
+    bool shape_ok = estl::any_of(s.kh, 3, 5, 7) && estl::any_of(s.kw, 3, 5, 7)
+        && (s.ws == 1 || s.ws == 2)
+        && estl::any_of(s.lp, s.kw / 2 - 1, s.kw / 2)
+        && estl::any_of(s.rp, s.kw / 2 - 1, s.kw / 2)
+        && estl::any_of(s.tp, s.kh / 2 - 1, s.kh / 2)
+        && estl::any_of(s.bp, s.kh / 2 - 1, s.kh / 2);
+    if (!shape_ok)
+      return FLT_MAX;
+  }
+
+  int ICp = (s.g == 1 && s.ic < V) ? s.ic : ALIGNUP(icg, V);
+  int OCp = ALIGNUP(ocg, V);
+  if (depthwise && int8) ICp = OCp = 1; // per channel, V channels a FMA
+
+  auto kp = best_kernel(s, conv_kernel, OCp / V > 0 ? OCp / V : 1, s.ow,
+                        !int8 && s.f16c_opt ? CVT_W : CVT_NONE,
+                        s.lp, s.rp);
+  if (kp.eff == 0.0f)
+    return FLT_MAX;
+  if (!conv_kernel && divup(s.ow, kp.T) > 128)
+    return FLT_MAX;
+
+  size_t in_b = int8 ? 1 : 4, out_b = int8 && s.output_dt != f32 ? 1 : 4;
+  size_t w_b = int8 ? 1 : s.f16c_opt ? 2 : 4;
+  int nthr = s.nthreads;
+  const auto &ci = el_cache_info();
+
+  float flops = 2.0f * s.n * s.g * s.oh * s.ow * OCp * ICp * s.kh * s.kw;
+  float wgroup = (float)s.kh * s.kw * ICp * OCp * w_b;
+
+  // c070 splits ic by I4 to keep weights in L2, partial sums in toutput
+  int I4 = estl::max(1, s.I4);
+  if (ICp % (I4 * V) != 0 && I4 > 1)
+    return FLT_MAX;
+  if (xopt == 0xc070 && s.I4 == 0)
+    I4 = split_to_fit(ICp / V, wgroup, ci.l2 / 2);
+
+  float wt = divup(s.ow, kp.T);
+  float tasks = (float)s.n * s.g * s.oh * wt * I4;
+  float bal = balance(tasks, nthr);
+
+  cost_traffic_t tr(nthr);
+  tr.add(tasks * wgroup / I4, wgroup / I4, true);
+  tr.add_tensor(s.g * wgroup);
+  tr.add((float)s.n * s.g * s.oh * s.kh * s.iw * ICp * in_b,
+         (float)s.kh * s.iw * ICp * in_b / I4, false);
+  tr.add_tensor((float)s.n * s.ic * s.ih * s.iw * in_b);
+  tr.add_tensor((float)s.n * s.oc * s.oh * s.ow * out_b
+                * (s.with_ip_sum ? 2 : 1));
+
+  float cycles = compute_cycles(flops, kp.eff, bal, nthr, int8);
+  float sync = COST_SYNC_CYCLES;
+  if (xopt == 0xc070) {
+    float toutput = (float)I4 * s.n * s.g * OCp * s.oh * s.ow * 4;
+    tr.add(2 * toutput, toutput, true);
+    tr.add_scratch(toutput);
+    cycles += trans_cycles(toutput / 4, nthr);
+    sync *= 2;
+  }
+  return estl::max(cycles, tr.cycles(bal)) + sync;
+}
+
+// Vector multi-group direct, c060 only
+static float cost_direct_vmg(const conv_cost_shape_t &s, int xopt) {
+  if (!is_fp32(s) || xopt != 0xc060)
+    return FLT_MAX;
+  int ocg = s.oc / s.g;
+  bool shape_ok = s.ic % s.g == 0 && s.oc % s.g == 0 && ocg <= V
+      && V % ocg == 0 && s.oc % V == 0 && s.ic == s.oc
+      && estl::any_of(s.kh, 3, 5, 7) && estl::any_of(s.kw, 3, 5, 7)
+      && s.ws == 1 && s.hd == 1 && s.wd == 1
+      && s.lp == s.kw / 2 && s.tp == s.kh / 2;
+  bool format_ok = s.weights_fmt == ghwio
+      && estl::any_of(s.input_fmt, nchw, nChw16c)
+      && estl::any_of(s.output_fmt, nchw, nChw16c);
+  if (!shape_ok || !format_ok)
+    return FLT_MAX;
+
+  auto kp = best_kernel(s, true, 1, s.ow, s.f16c_opt ? CVT_W : CVT_NONE,
+                        s.lp, s.rp);
+  if (kp.eff == 0.0f || kp.O != 1)
+    return FLT_MAX;
+
+  int nthr = s.nthreads;
+  int vg = s.g / (V / ocg);
+  float flops = 2.0f * s.n * s.oh * s.ow * s.oc * ocg * s.kh * s.kw;
+  float tasks = (float)s.n * vg * s.oh * divup(s.ow, kp.T);
+  float wgroup = (float)s.kh * s.kw * V * V * (s.f16c_opt ? 2 : 4);
+
+  cost_traffic_t tr(nthr);
+  tr.add(tasks * wgroup, wgroup, true);
+  tr.add_tensor(vg * wgroup);
+  tr.add((float)s.n * s.oh * s.kh * s.iw * s.ic * 4,
+         (float)s.kh * s.iw * V * 4, false);
+  tr.add_tensor((float)s.n * s.ic * s.ih * s.iw * 4);
+  tr.add_tensor((float)s.n * s.oc * s.oh * s.ow * 4
+                * (s.with_ip_sum ? 2 : 1));
+
+  float bal = balance(tasks, nthr);
+  float cycles = compute_cycles(flops, kp.eff, bal, nthr, false);
+  return estl::max(cycles, tr.cycles(bal)) + COST_SYNC_CYCLES;
+}
+
+// Winograd F(A-2, 3): a000/a033/a061/a071/a073, int8 a133/a161/a173
+static float cost_wino(const conv_cost_shape_t &s, int xopt, int A) {
+  bool int8_impl = (xopt & 0xF00) == 0x100;
+  if (int8_impl) {
+    if (!(is_int8(s) || is_fp32(s)) || !s.calibrated || s.input_quant_z)
+      return FLT_MAX;
+    if (!estl::any_of(xopt, 0xa133, 0xa161, 0xa173) || A < 4 || A > 6
+        || s.kh != 3)
+      return FLT_MAX;
+  } else {
+    if (!is_fp32(s))
+      return FLT_MAX;
+    if (!estl::any_of(xopt, 0xa000, 0xa033, 0xa061, 0xa071, 0xa073)
+        || !elx_conv_wino_supported(A, s.kh))
+      return FLT_MAX;
+  }
+  if (s.hs != 1 || s.ws != 1 || s.hd != 1 || s.wd != 1) {
+    // Polyphase, dilation only: stride-1 sub-convolution plus input
+    // gather and output scatter, see elx_conv_polyphase.hpp
+    polyphase_dim_t h, w;
+    if (int8_impl || s.g != 1
+        || !polyphase_dim_init(h, s.ih, s.oh, s.kh, s.hs, s.hd, s.tp)
+        || !polyphase_dim_init(w, s.iw, s.ow, s.kw, s.ws, s.wd, s.lp))
+      return FLT_MAX;
+    conv_cost_shape_t ps = s;
+    ps.n = s.n * h.P * w.P;
+    ps.ic = ALIGNUP(s.ic, V);
+    ps.ih = h.m + 2, ps.iw = w.m + 2, ps.oh = h.m, ps.ow = w.m;
+    ps.lp = ps.rp = ps.tp = ps.bp = 0;
+    ps.hs = ps.ws = ps.hd = ps.wd = 1;
+    ps.input_fmt = nChw16c;
+    if (h.P * w.P > 1)
+      ps.output_fmt = nChw16c;
+    float c = cost_wino(ps, xopt, A);
+    if (c == FLT_MAX)
+      return FLT_MAX;
+    float sub_in = (float)ps.n * ps.ic * ps.ih * ps.iw * 4;
+    float sub_out = (float)ps.n * ALIGNUP(s.oc, V) * ps.oh * ps.ow * 4;
+    cost_traffic_t tr(s.nthreads);
+    tr.add_tensor(2 * sub_in);
+    if (h.P * w.P > 1)
+      tr.add_tensor(2 * sub_out * (s.with_ip_sum ? 2 : 1));
+    return c + tr.cycles(1.0f);
+  }
+  if (s.kh != s.kw || s.g != 1)
+    return FLT_MAX;
+  if (s.oc % V != 0 && s.output_fmt == nhwc)
+    return FLT_MAX;
+  if ((xopt == 0xa073 || s.with_ip_sum) && s.with_relu
+      && s.output_fmt != nChw16c)
+    return FLT_MAX;
+
+  const auto &ci = el_cache_info();
+  int nthr = s.nthreads;
+  int m = A - s.kh + 1;
+  int IC = ALIGNUP(s.ic, V), OC = ALIGNUP(s.oc, V);
+  int ic2 = IC / V, oc2 = OC / V;
+  float t = (float)s.n * divup(s.oh, m) * divup(s.ow, m);
+
+  // f16 transformed buffers below tile size 8 only, see setup()
+  if (!int8_impl && A == 8 && s.f16c_opt && !s.autoparam)
+    return FLT_MAX;
+  size_t tw_b = int8_impl ? 1 : (s.f16c_opt || s.autoparam) && A < 8 ? 2 : 4;
+  size_t ti_b = int8_impl ? 1 : 4;
+  float tweights = (float)A * A * IC * OC * tw_b;
+
+  // Fused modes want t2 >= nthreads. Tasks of a thread walk O4/I4
+  // slices of one t2, so tweights reuse distance is all of tweights.
+  // O4/I4 only shrink the per thread tinput/toutput working set.
+  bool fused = estl::any_of(xopt & 0xFF, 0x61, 0x71, 0x73);
+  float tpt = fused ? estl::max(1.0f, t / nthr) : t;
+  kernel_plan_t kp = { 0, 0, 0.0f };
+  for (int O = 1; O <= (int)estl::size(kgemm_max_T); ++O) {
+    if (oc2 % O != 0 || (s.O && O != s.O)) continue;
+    int T = s.T ? s.T : estl::min(kgemm_max_T[O - 1], (int)tpt);
+    if (T > kgemm_max_T[O - 1]) continue;
+    float eff = row_eff(O, T, (int)estl::min(tpt, 64.0f * T),
+                        tw_b == 2 ? CVT_IW : CVT_NONE);
+    if (eff > kp.eff) kp = { O, T, eff };
+  }
+  if (kp.eff == 0.0f)
+    return FLT_MAX;
+  float t2 = divup(t, kp.T);
+
+  float tinput = (float)A * A * IC * ti_b;   // per tile
+  float toutput = (float)A * A * OC * 4;     // per tile
+
+  // FUS_O splits toutput by O4, FUS_I tinput by I4, to fit L2
+  int O4 = estl::max(1, s.O4), I4 = estl::max(1, s.I4);
+  if ((O4 > 1 && !(xopt & 0x20)) || (I4 > 1 && !(xopt & 0x10))
+      || oc2 % (kp.O * O4) != 0 || ic2 % I4 != 0)
+    return FLT_MAX;
+  if ((xopt & 0x20) && s.O4 == 0)
+    O4 = split_to_fit(oc2 / kp.O, kp.T * toutput, ci.l2 / 4);
+  if ((xopt & 0x10) && s.I4 == 0)
+    I4 = split_to_fit(ic2, kp.T * tinput, ci.l2 / 4);
+
+  // a073 accumulates partial outputs per I4 in trans-output
+  float gemm_flops = 2.0f * A * A * t * IC * OC;
+  float tin_flops = 4.0f * A * A * A * t * IC;
+  float tout_flops = 2.0f * A * m * (A + m) * t * OC
+      * ((xopt & 0xFF) == 0x73 ? I4 : 1);
+
+  float in_bytes = (float)s.n * s.ic * s.ih * s.iw * (is_int8(s) ? 1 : 4);
+  float out_bytes = (float)s.n * s.oc * s.oh * s.ow
+      * (s.output_dt == f32 ? 4 : 1);
+
+  cost_traffic_t tr(nthr);
+  tr.add_tensor(tweights);
+  tr.add_tensor(in_bytes);
+  tr.add_tensor(out_bytes * (s.with_ip_sum ? 2 : 1));
+
+  float tasks, sync;
+  switch (xopt & 0xFF) {
+  case 0x00:
+  case 0x33:
+    // Transform all tiles into scratch, gemm per (A, A), barriers between
+    tasks = (float)A * A * t2 * estl::max(1, oc2 / kp.O / O4);
+    tr.add(t2 * tweights, tweights / (A * A), true);
+    tr.add(2 * t * tinput, t * tinput, true);
+    tr.add(2 * t * toutput / O4, t * toutput / O4, true);
+    tr.add_scratch(t * (tinput + toutput / O4));
+    sync = COST_SYNC_CYCLES * (1 + 2 * I4 * O4);
+    break;
+  case 0x61:
+    // Per T tiles: trans-input, gemm against all tweights, trans-output
+    tasks = t2 * O4;
+    tr.add(t2 * tweights, tweights, true);
+    tr.add(2 * t * (tinput + toutput / O4),
+           kp.T * (tinput + toutput / O4), false);
+    tr.add_scratch(nthr * kp.T * (tinput + toutput / O4));
+    sync = COST_SYNC_CYCLES;
+    break;
+  case 0x71:
+    // toutput of all tiles accumulated over I4
+    tasks = t2 * O4;
+    tr.add(t2 * tweights, tweights, true);
+    tr.add(2 * t * tinput, kp.T * tinput / I4, false);
+    tr.add(2 * I4 * t * toutput, t * toutput, true);
+    tr.add_scratch(nthr * kp.T * tinput / I4 + t * toutput);
+    sync = COST_SYNC_CYCLES;
+    break;
+  case 0x73:
+    // Output accumulated over I4
+    tasks = t2 * O4;
+    tr.add(t2 * tweights, tweights, true);
+    tr.add(2 * t * (tinput + toutput / O4),
+           kp.T * (tinput / I4 + toutput / O4), false);
+    tr.add_tensor(2 * (I4 - 1) * out_bytes);
+    tr.add_scratch(nthr * kp.T * (tinput / I4 + toutput / O4));
+    sync = COST_SYNC_CYCLES;
+    break;
+  default:
+    return FLT_MAX;
+  }
+
+  float bal = balance(tasks, nthr);
+  float cycles = compute_cycles(gemm_flops, kp.eff, bal, nthr, int8_impl)
+      + trans_cycles(tin_flops + tout_flops, nthr) / bal;
+  return estl::max(cycles, tr.cycles(bal)) + sync;
+}
+
+// Direct 1x1: a060/a061/a061p1(0xa062)/a061p2(0xa063), int8 a160
+static float cost_direct_1x1(const conv_cost_shape_t &s, int xopt) {
+  bool int8 = is_int8(s);
+  if (s.kh != 1 || s.kw != 1 || s.g != 1)
+    return FLT_MAX;
+  if (!is_fp32(s) && !(int8 && s.output_dt != f32 && s.calibrated))
+    return FLT_MAX;
+
+  bool no_pad = s.lp == 0 && s.rp == 0 && s.tp == 0 && s.bp == 0;
+  bool blocked = s.input_fmt == nChw16c && s.weights_fmt == OIhw16i16o
+      && s.output_fmt == nChw16c;
+  bool gathered, plain;
+  if (int8) {
+    if (xopt != 0xa160 || !no_pad || s.hs > 2 || s.ws > 2)
+      return FLT_MAX;
+    if (s.oc % V != 0 && !blocked)
+      return FLT_MAX;
+    gathered = s.ws == 2;
+    plain = false;
+  } else {
+    if (!estl::any_of(xopt, 0xa060, 0xa061, 0xa062, 0xa063))
+      return FLT_MAX;
+    plain = xopt == 0xa062 || xopt == 0xa063;
+    if (!blocked && !plain)
+      return FLT_MAX;
+    if (!no_pad && xopt != 0xa063)
+      return FLT_MAX;
+    if (estl::any_of(xopt, 0xa060, 0xa062) && (s.hs != 1 || s.ws != 1))
+      return FLT_MAX;
+    if (s.with_ip_sum && s.with_relu && s.output_fmt != nChw16c)
+      return FLT_MAX;
+    gathered = estl::any_of(xopt, 0xa061, 0xa063);
+    if (gathered && no_pad
+        && (s.oh * s.hs != s.ih || s.ow * s.ws != s.iw))
+      return FLT_MAX;
+  }
+
+  const auto &ci = el_cache_info();
+  int nthr = s.nthreads;
+  int IC = ALIGNUP(s.ic, V), OC = ALIGNUP(s.oc, V);
+  int oc2 = OC / V;
+  float nt = (float)s.oh * s.ow;
+
+  // a061 modes block T on a row without tail, others on oh * ow
+  int cvt = !int8 && s.f16c_opt ? CVT_W : CVT_NONE;
+  auto kp = gathered ? best_kernel(s, false, oc2, s.ow, cvt, 0, 0, true)
+                     : best_kernel(s, false, oc2,
+                                   (int)estl::min(nt, 256.0f), cvt);
+  if (kp.eff == 0.0f)
+    return FLT_MAX;
+
+  size_t in_b = int8 ? 1 : 4, out_b = int8 ? 1 : 4;
+  size_t w_b = int8 ? 1 : s.f16c_opt ? 2 : 4;
+  float weights = (float)IC * OC * w_b;
+  int O4 = s.O4 ? s.O4 : split_to_fit(oc2 / kp.O, weights, ci.l2 / 2);
+  if (s.I4 > 1 && ((plain && !int8) || s.ic % V != 0 || IC % (s.I4 * V)))
+    return FLT_MAX;
+
+  float flops = 2.0f * s.n * nt * IC * OC;
+  float tasks = (float)s.n * O4 * divup(nt, kp.T);
+  float in_bytes = (float)s.n * s.ic * s.ih * s.iw * in_b;
+  float out_bytes = (float)s.n * s.oc * nt * out_b;
+
+  cost_traffic_t tr(nthr);
+  tr.add(tasks * weights / O4, weights / O4, true);
+  tr.add_tensor(weights);
+  tr.add(O4 * in_bytes, (float)kp.T * IC * in_b, false);
+  tr.add_tensor(in_bytes);
+  tr.add_tensor(out_bytes * (s.with_ip_sum ? 2 : 1));
+
+  float trans = 0.0f;
+  if (gathered) {
+    // strided input gather into tinput
+    float tinput = (float)s.n * IC * nt * in_b;
+    tr.add(2 * tinput, (float)IC * s.ow * in_b, false);
+    tr.add_scratch(tinput);
+    trans += tinput / in_b;
+  }
+  if (plain) {
+    // plain <-> blocked transposes of input and output
+    tr.add(2 * in_bytes, (float)IC * kp.T * 4, false);
+    tr.add(2 * out_bytes, (float)OC * kp.T * 4, false);
+    trans += 2 * (in_bytes + out_bytes) / 4;
+  }
+
+  float bal = balance(tasks, nthr);
+  float cycles = compute_cycles(flops, kp.eff, bal, nthr, int8)
+      + trans_cycles(trans, nthr);
+  return estl::max(cycles, tr.cycles(bal)) + COST_SYNC_CYCLES;
+}
+
+float conv_cost(const conv_cost_shape_t &s, int algorithm, int xopt,
+                int tile_size) {
+  if (s.n <= 0 || s.g <= 0 || s.ic % s.g != 0 || s.oc % s.g != 0)
+    return FLT_MAX;
+  switch (algorithm) {
+  case CONV_DIRECT: return cost_direct(s, xopt);
+  case CONV_DIRECT_VMG: return cost_direct_vmg(s, xopt);
+  case CONV_DIRECT_1X1: return cost_direct_1x1(s, xopt);
+  case CONV_WINOGRAD: return cost_wino(s, xopt, tile_size);
+  default: return FLT_MAX;
+  }
+}
+
+bool conv_xopt_supported(const conv_cost_shape_t &s, int algorithm,
+                         int xopt, int tile_size) {
+  return conv_cost(s, algorithm, xopt, tile_size) < FLT_MAX;
+}
+
+static const int direct_xopts[] = { 0xc060, 0xc070, 0xa060, 0xc160, 0xa160 };
+static const int vmg_xopts[] = { 0xc060 };
+static const int direct_1x1_xopts[] = { 0xa060, 0xa061, 0xa062, 0xa063,
+                                        0xa160 };
+static const int wino_xopts[] = { 0xa000, 0xa033, 0xa061, 0xa071, 0xa073,
+                                  0xa133, 0xa161, 0xa173 };
+
+int conv_xopt_plan(const eld_conv_t &desc, int algorithm, int tile_size) {
+  const int *xopts;
+  size_t n;
+  switch (algorithm) {
+  case CONV_DIRECT:
+    xopts = direct_xopts; n = estl::size(direct_xopts); break;
+  case CONV_DIRECT_VMG:
+    xopts = vmg_xopts; n = estl::size(vmg_xopts); break;
+  case CONV_DIRECT_1X1:
+    xopts = direct_1x1_xopts; n = estl::size(direct_1x1_xopts); break;
+  case CONV_WINOGRAD:
+    xopts = wino_xopts; n = estl::size(wino_xopts); break;
+  default:
+    return 0;
+  }
+
+  auto s = conv_cost_shape(desc);
+  // fp32 user data runs int8 Winograd only on explicit request
+  bool fp32_user = is_fp32(s);
+
+  int best = 0;
+  float best_cost = FLT_MAX;
+  for (size_t i = 0; i < n; ++i) {
+    if (algorithm == CONV_WINOGRAD && fp32_user
+        && (xopts[i] & 0xF00) == 0x100)
+      continue;
+    float cost = conv_cost(s, algorithm, xopts[i], tile_size);
+    if (cost < best_cost) {
+      best_cost = cost;
+      best = xopts[i];
+    }
+  }
+  el_log(__DEBUG, "xopt-plan: %s: %s, A=%d: xopt=%x, %.0f cycles",
+         desc.name.c_str(), algorithm_to_string(algorithm), tile_size, best,
+         best_cost);
+  return best;
+}
+
+struct conv_cost_candidate_t {
+  int algorithm, xopt, tile_size;
+};
+
+void conv_cost_select(eld_conv_t &desc) {
+  bool select_alg = desc.algorithm == CONV_AUTO;
+  bool select_tile = desc.tile_size == 0
+      && (select_alg || desc.algorithm == CONV_WINOGRAD);
+  if (!select_alg && !select_tile)
+    return;
+
+  std::vector<conv_cost_candidate_t> cands;
+  auto add = [&](int alg, const int *xopts, size_t n, int tile) {
+    if (!select_alg && alg != desc.algorithm) return;
+    for (size_t i = 0; i < n; ++i) {
+      // User execution_mode pins xopt
+      if (desc.execution_mode != 0 && desc.execution_mode != xopts[i])
+        continue;
+      cands.push_back({ alg, xopts[i], tile });
+    }
+  };
+  // In order of preference on near ties
+  if (select_alg) {
+    add(CONV_DIRECT_1X1, direct_1x1_xopts, estl::size(direct_1x1_xopts), 0);
+    add(CONV_DIRECT, direct_xopts, estl::size(direct_xopts), 0);
+    add(CONV_DIRECT_VMG, vmg_xopts, estl::size(vmg_xopts), 0);
+  }
+  if (desc.tile_size != 0) {
+    add(CONV_WINOGRAD, wino_xopts, estl::size(wino_xopts), desc.tile_size);
+  } else {
+    for (int A = 4; A <= 8; ++A)
+      add(CONV_WINOGRAD, wino_xopts, estl::size(wino_xopts), A);
+  }
+
+  auto s = conv_cost_shape(desc);
+  float best_cost = FLT_MAX;
+  conv_cost_candidate_t best = { 0, 0, 0 };
+  for (auto &c : cands) {
+    float cost = conv_cost(s, c.algorithm, c.xopt, c.tile_size);
+    if (cost == FLT_MAX) continue;
+    el_log(__DEBUG, "cost: %s: %s, xopt=%x, A=%d: %.0f cycles",
+           desc.name.c_str(), algorithm_to_string(c.algorithm), c.xopt,
+           c.tile_size, cost);
+    bool better = c.algorithm == best.algorithm
+        ? cost < best_cost : cost < best_cost * (1.0f - COST_SELECT_MARGIN);
+    if (better) {
+      best_cost = cost;
+      best = c;
+    }
+  }
+  if (best_cost == FLT_MAX)
+    return;
+
+  if (select_alg)
+    desc.algorithm = best.algorithm;
+  if (select_tile && best.algorithm == CONV_WINOGRAD)
+    desc.tile_size = best.tile_size;
+  el_log(__DEBUG, "cost: %s: select %s, xopt=%x, A=%d, %.0f cycles",
+         desc.name.c_str(), algorithm_to_string(best.algorithm), best.xopt,
+         best.tile_size, best_cost);
+}
+
+}  // namespace euler
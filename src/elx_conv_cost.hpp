@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "euler.hpp"
+
+namespace euler {
+
+// Roofline-style cost model
+//
+// Estimates cycles of one forward inference pass of a convolution on an
+// engine/xopt: FMA throughput at the kernel register blocking, transform
+// overhead, bytes moved per cache level and thread load balance. Blocking
+// (O/T) is assumed to be chosen by user or auto-tuner, i.e. near the
+// kernel sweet spot. Returns FLT_MAX for unsupported engine/xopt.
+
+struct conv_cost_shape_t {
+  int n, g, ic, oc, ih, iw, oh, ow, kh, kw;
+  int lp, rp, tp, bp, hs, ws, hd, wd;
+  int input_fmt, weights_fmt, output_fmt;
+  uint8_t input_dt, weights_dt, output_dt;
+  bool with_relu, with_ip_sum, f16c_opt;
+  bool autoparam;     // winograd turns on f16c_opt
+  bool input_quant_z; // non-zero input zero point
+  bool calibrated;    // sampling_kind == CALIBRATED
+  int O, T, I4, O4;   // user flatting/partition, 0: engine default
+  int nthreads;
+};
+
+// Per-core L1/L2 and total LLC size in bytes (sysfs, or defaults)
+struct el_cache_info_t {
+  size_t l1, l2, llc;
+};
+const el_cache_info_t &el_cache_info();
+
+conv_cost_shape_t conv_cost_shape(const eld_conv_t &desc);
+
+bool conv_xopt_supported(const conv_cost_shape_t &s, int algorithm,
+                         int xopt, int tile_size = 0);
+float conv_cost(const conv_cost_shape_t &s, int algorithm, int xopt,
+                int tile_size = 0);
+
+// xopt planner: lowest cost xopt of engine algorithm/tile_size for desc,
+// with scratch footprint, fusion and user blocking taken into account.
+// Returns 0 if no xopt is supported.
+int conv_xopt_plan(const eld_conv_t &desc, int algorithm,
+                   int tile_size = 0);
+
+// Pick desc.algorithm if CONV_AUTO and desc.tile_size of CONV_WINOGRAD
+// if 0 with the lowest estimated cost
+void conv_cost_select(eld_conv_t &desc);
+
+}  // namespace euler
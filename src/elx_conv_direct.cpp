@@ -2,6 +2,8 @@
 #include "el_stl.hpp"
 #include "el_utils.hpp"
 #include "el_parallel.hpp"
+#include "elx_conv_cost.hpp"
+#include "elx_post_ops.hpp"
 #include "elx_conv_direct.hpp"
 #include "elx_conv_direct_bind.hpp"
 #include "elx_conv_direct_xopt.hpp"
@@ -14,13 +16,15 @@ Instance_elx_conv_direct_t::elx_conv_direct_t(eld_conv_t &dc)
 {
   // user input
   xopt_ = ep.execution_mode;
+  if (xopt_ == 0)
+    xopt_ = conv_xopt_plan(dc, CONV_DIRECT);
   if (xopt_ == 0) {
     if (estl::any_of(ep.kw, 3, 5, 7))
       xopt_ = 0xc060; // conv kernel
     else
       xopt_ = 0xa060; // gemm kernel
   }
-  mthr_ = estl::max_concurrency();
+  mthr_ = ep.nthreads;
 
   ep.vmg = 1;
   ep.Vx = 1;
@@ -137,6 +141,9 @@ Instance_elx_conv_direct_t::elx_conv_direct_t(eld_conv_t &dc)
 
   prepare_execute_opt();
   bind_execute_functions();
+  // Elementwise post-ops along with relu, plain sum is apart
+  ep.post_ops_fused = !ep.post_ops.empty() && post_ops_eltwise(ep)
+      && !(ep.with_ip_sum && ep.output_fmt != nChw16c);
 
   // dbg
   el_log(__DEBUG, "T=%d, Tr=%d, t2=%d, ht=%d, wt=%d, t=%d",
@@ -152,7 +159,10 @@ Template_elx_conv_direct_t
 int Instance_elx_conv_direct_t::prepare_execute_opt()
 {
   if (ep.with_ip_sum && ep.with_relu && ep.output_fmt != nChw16c) {
-    el_error("Unimplemented: fuse sum (plain format) and relu together");
+    // Relu after the sum, by the post-op pass
+    if (ep.output_data_type != f32)
+      el_error("Unimplemented: fuse sum (plain format) and relu together");
+    post_ops_defer_relu(ep);
   }
 
   toutput_size_ = 0;
@@ -389,6 +399,7 @@ Instance_elx_conv_direct_t::conv_c060(OutputType *output,
       if (_I4 == ep.I4 - 1 && _I3 == ep.I3 - 1) {
         if (ep.Ir != V) attr = set_bit(attr, AT_Ir_MASK);
         if (ep.with_relu) attr = set_bit(attr, AT_RELU_MASK);
+        if (ep.post_ops_fused) attr = set_bit(attr, AT_POST_OPS_MASK);
       }
       if (ep.Or != V && _O4 == ep.O4 - 1 && _O3 == ep.O3 - 1) {
         attr = set_bit(attr, AT_Or_MASK);
@@ -407,6 +418,7 @@ Instance_elx_conv_direct_t::conv_c060(OutputType *output,
       if (_I4 == ep.I4 - 1 && _I3 == ep.I3 - 1) {
         if (ep.Ir != V) attr = set_bit(attr, AT_Ir_MASK);
         if (ep.with_relu) attr = set_bit(attr, AT_RELU_MASK);
+        if (ep.post_ops_fused) attr = set_bit(attr, AT_POST_OPS_MASK);
       }
       ker_conv(ep, &md2(aoutput, _O3, 0),
           &md4(ainput, _I3, 0, _ih, _iw), &md3(aweights, _O3, _I3, 0),
@@ -422,6 +434,7 @@ Instance_elx_conv_direct_t::conv_c060(OutputType *output,
       if (_I4 == ep.I4 - 1 && _I3 == ep.I3 - 1) {
         if (ep.Ir != V) attr = set_bit(attr, AT_Ir_MASK);
         if (ep.with_relu) attr = set_bit(attr, AT_RELU_MASK);
+        if (ep.post_ops_fused) attr = set_bit(attr, AT_POST_OPS_MASK);
       }
       ker_conv(ep, &md2(aoutput, _O3, 0),
           &md5(ainput, _I3, 0, _ih, _iw, 0), &md3(aweights, _O3, _I3, 0),
@@ -552,7 +565,7 @@ void Instance_elx_conv_direct_t::gemm_a060(OutputType *output, InputType *input,
       }
 
       if (_I4 == ep.I4 - 1 && _I3 == ep.I3 - 1) {
-        if (ep.with_relu) {
+        if (ep.with_relu || ep.post_ops_fused) {
           iter_each (_O2, ep.O2) {
             bool O2_has_Or = oc3_has_Or && (_O2 == ep.O2 - 1);
             __mmask16 k = _mm512_int2mask(O2_has_Or ? ep.ormask : 0xFFFF);
@@ -561,10 +574,14 @@ void Instance_elx_conv_direct_t::gemm_a060(OutputType *output, InputType *input,
                 MD4(OutputType, aoutput1, &md4(aoutput0, _ht, ows0 + _T, 0, 0),
                     ep.O4, ep.O3, ep.O2, V);
                 auto s = *(__m<V> *)&md4(aoutput1, 0, _O3, _O2, 0);
-                auto lower = *(__m<V> *)(ep.relu_bound_lower_vec);
-                auto upper = *(__m<V> *)(ep.relu_bound_upper_vec);
-                s = _mm<V>::max_ps(s, lower);
-                s = _mm<V>::min_ps(s, upper);
+                if (ep.with_relu) {
+                  auto lower = *(__m<V> *)(ep.relu_bound_lower_vec);
+                  auto upper = *(__m<V> *)(ep.relu_bound_upper_vec);
+                  s = _mm<V>::max_ps(s, lower);
+                  s = _mm<V>::min_ps(s, upper);
+                }
+                if (ep.post_ops_fused)
+                  s = post_ops_apply<V>(ep, s);
                 _mm512_mask_store_ps(&md4(aoutput1, 0, _O3, _O2, 0), k, s);
               }
             } else el_error("direct: a060: unimplemented");
@@ -605,15 +622,19 @@ void Instance_elx_conv_direct_t::gemm_a060(OutputType *output, InputType *input,
       }
 
       if (_I4 == ep.I4 - 1 && _I3 == ep.I3 - 1) {
-        if (ep.with_relu) {
+        if (ep.with_relu || ep.post_ops_fused) {
           iter_each (_O2, ep.O2) {
           iter_each (_T, Tz) {
             if (I == ISA_AVX512 && std::is_same<OutputType, float>::value) {
               auto s = *(__m<V> *)&md5(aoutput, _O3, _O2, _ht, ows0 + _T, 0);
-              auto lower = *(__m<V> *)(ep.relu_bound_lower_vec);
-              auto upper = *(__m<V> *)(ep.relu_bound_upper_vec);
-              s = _mm<V>::max_ps(s, lower);
-              s = _mm<V>::min_ps(s, upper);
+              if (ep.with_relu) {
+                auto lower = *(__m<V> *)(ep.relu_bound_lower_vec);
+                auto upper = *(__m<V> *)(ep.relu_bound_upper_vec);
+                s = _mm<V>::max_ps(s, lower);
+                s = _mm<V>::min_ps(s, upper);
+              }
+              if (ep.post_ops_fused)
+                s = post_ops_apply<V>(ep, s);
               _mm<V>::store_ps(&md5(aoutput, _O3, _O2, _ht, ows0 + _T, 0), s);
             } else
               el_error("direct: a060: unimplemented");
@@ -2,6 +2,8 @@
 #include "elx_conv_direct_1x1_bind.hpp"
 #include "elx_conv_direct_1x1_xopt.hpp"
 #include "el_parallel.hpp"
+#include "elx_conv_cost.hpp"
+#include "elx_post_ops.hpp"
 
 namespace euler {
 
@@ -11,6 +13,8 @@ Instance_elx_conv_direct_1x1_t::elx_conv_direct_1x1_t(eld_conv_t &dc)
 {
   // user input
   xopt_ = ep.execution_mode;
+  if (xopt_ == 0)
+    xopt_ = conv_xopt_plan(dc, CONV_DIRECT_1X1);
   if (xopt_ == 0) {
     if (ep.input_fmt == nChw16c) {
       xopt_ = ep.ws == 1 ? a060 : a061;
@@ -104,16 +108,21 @@ Instance_elx_conv_direct_1x1_t::elx_conv_direct_1x1_t(eld_conv_t &dc)
   attr_ = 0x0;
   is_first_run_ = true;
   inference_acc_ = false;
-  mthr_ = estl::max_concurrency();
+  mthr_ = ep.nthreads;
   inference_acc_ = ep.prop_kind == forward_inference;
+  replicate_workspace_ = ep.numa;
 
   attr_ = ep.with_bias ? set_bit(attr_, AT_BIAS_MASK) : attr_;
-  if (xopt_ == a061 || xopt_ == a060) {
+  // nhwc output is written by the kernel, sum included
+  if (xopt_ == a061 || xopt_ == a060 || ep.output_fmt == nhwc) {
     attr_ = ep.with_ip_sum ? set_bit(attr_, AT_INP_SUM_MASK) : attr_;
   }
 
   prepare_execute_opt();
   bind_execute_functions();
+  // Elementwise post-ops along with relu, nchw sum is after the kernel
+  ep.post_ops_fused = !ep.post_ops.empty() && post_ops_eltwise(ep)
+      && !(ep.with_ip_sum && !output_is_bfmt_ && ep.output_fmt != nhwc);
 
   // dbg
   el_log(__DEBUG, "T=%d, Tr=%d, t2=%d, ht=%d, wt=%d, t=%d",
@@ -144,8 +153,12 @@ int  Instance_elx_conv_direct_1x1_t::prepare_execute_opt()
   output_as_bfmt_ = ep.output_fmt == nchw && ep.output_as_blocked;
   is_bfmt_ = input_is_bfmt_ && weights_is_bfmt_ && output_is_bfmt_;
 
-  if (ep.with_ip_sum && ep.with_relu && !output_is_bfmt_) {
-    el_error("Unimplemented: fuse sum (plain format) and relu together");
+  if (ep.with_ip_sum && ep.with_relu && !output_is_bfmt_
+      && ep.output_fmt != nhwc) {
+    // Relu after the sum, by the post-op pass
+    if (ep.output_data_type != f32)
+      el_error("Unimplemented: fuse sum (plain format) and relu together");
+    post_ops_defer_relu(ep);
   }
 
   if (ep.I4 > 1 && ep.Ir != V) {
@@ -1215,6 +1228,7 @@ void Instance_elx_conv_direct_1x1_t::gemm_a061p2(ToutputType *output,
     if (_I4 == ep.I4 - 1) {
       if (ep.Ir != V) attr = set_bit(attr, AT_Ir_MASK);
       if (ep.with_relu) attr = set_bit(attr, AT_RELU_MASK);
+      if (ep.post_ops_fused) attr = set_bit(attr, AT_POST_OPS_MASK);
     }
     iter_each (_O3, ep.O3) {
       ker_gemm_I_O_T_(
@@ -1248,6 +1262,7 @@ void Instance_elx_conv_direct_1x1_t::gemm_a061p2(ToutputType *output,
     if (_I4 == ep.I4 - 1) {
       if (ep.Ir != V) attr = set_bit(attr, AT_Ir_MASK);
       if (ep.with_relu) attr = set_bit(attr, AT_RELU_MASK);
+      if (ep.post_ops_fused) attr = set_bit(attr, AT_POST_OPS_MASK);
     }
     iter_each (_O3, ep.O3) {
       ker_gemm_I_O_T_(
@@ -1282,6 +1297,9 @@ void Instance_elx_conv_direct_1x1_t::gemm_a061(OutputType *output,
     attr = ep.with_relu && last_ic3
         ? set_bit(attr, AT_RELU_MASK)
         : attr;
+    attr = ep.post_ops_fused && last_ic3
+        ? set_bit(attr, AT_POST_OPS_MASK)
+        : attr;
     attr = ep.Ir != V && last_ic3 ? set_bit(attr, AT_Ir_MASK) : attr;
 
     iter_each (_O3, ep.O3) {
@@ -1322,6 +1340,7 @@ void Instance_elx_conv_direct_1x1_t::gemm_a061p1(ToutputType *output,
     int attr = ep.I3 == 1 ? set_bit(attr_, AT_CLEAR_OUTPUT_MASK) : attr_;
     if (ep.Ir != V) attr = set_bit(attr, AT_Ir_MASK);
     if (ep.with_relu) attr = set_bit(attr, AT_RELU_MASK);
+    if (ep.post_ops_fused) attr = set_bit(attr, AT_POST_OPS_MASK);
     iter_each(_O3, ep.O3) {
       ker_gemm(
           ep,
@@ -1347,6 +1366,7 @@ void Instance_elx_conv_direct_1x1_t::gemm_a061p1(ToutputType *output,
     int attr = ep.I3 == 1 ? set_bit(attr_, AT_CLEAR_OUTPUT_MASK) : attr_;
     if (ep.Ir != V) attr = set_bit(attr, AT_Ir_MASK);
     if (ep.with_relu) attr = set_bit(attr, AT_RELU_MASK);
+    if (ep.post_ops_fused) attr = set_bit(attr, AT_POST_OPS_MASK);
     iter_each(_O3, ep.O3) {
       ker_gemm(
           ep,
@@ -1382,6 +1402,9 @@ void Instance_elx_conv_direct_1x1_t::gemm_a060(OutputType *output,
     attr = ep.with_relu && last_ic3
         ? set_bit(attr, AT_RELU_MASK)
         : attr;
+    attr = ep.post_ops_fused && last_ic3
+        ? set_bit(attr, AT_POST_OPS_MASK)
+        : attr;
     attr = ep.Ir != V && last_ic3 ? set_bit(attr, AT_Ir_MASK) : attr;
 
     MD2(InputType, ainput2, &md2(ainput, _I3, 0), ep.t2, ep.T * V);
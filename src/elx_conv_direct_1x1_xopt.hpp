@@ -38,7 +38,7 @@ void Instance_elx_conv_direct_1x1_t::__execute_a060(
     MD2(OutputType, aoutput, output, ep.n, ep.OC * ep.oh * ep.ow);
     MD2(BiasType, abias, bias, ep.O4, ep.O3 * ep.O2 * V);
 
-    MD3(TweightsType, atweights, tweights_, ep.O4, ep.I4,
+    MD3(TweightsType, atweights, numa_local(tweights_), ep.O4, ep.I4,
       ep.O3 * ep.I3 * ep.O2 * ep.I2 * V * V);
     MD2(OutputType, aoutput2, &md2(aoutput, _n, 0), ep.O4,
         ep.O3 * ep.O2 * ep.oh * ep.ow * V);
@@ -76,7 +76,7 @@ void Instance_elx_conv_direct_1x1_t::__execute_a061(
       MD2(BiasType, abias, bias, ep.O4, ep.O3 * ep.O2 * V);
 
       MD2(TinputType, atinput, tinput_, mthr_, ep.I3 * ep.I2 * ep.T * V);
-      MD3(TweightsType, atweights, tweights_, ep.O4, ep.I4,
+      MD3(TweightsType, atweights, numa_local(tweights_), ep.O4, ep.I4,
           ep.O3 * ep.I3 * ep.O2 * ep.I2 * V * V);
       size_t ithr = estl::current_thread_index();
       trans_input(
@@ -106,7 +106,7 @@ void Instance_elx_conv_direct_1x1_t::__execute_a061(
           ep.I3 * ep.I2 * ep.T * V);
       MD4(unsigned char, atinput_msk, tinput_msk_, mthr_,
           ep.I4, ep.ht, ep.wt);
-      MD3(TweightsType, atweights, tweights_, ep.O4, ep.I4,
+      MD3(TweightsType, atweights, numa_local(tweights_), ep.O4, ep.I4,
           ep.O3 * ep.I3 * ep.O2 * ep.I2 * V * V);
 
       int ithr = estl::current_thread_index();
@@ -158,7 +158,7 @@ void Instance_elx_conv_direct_1x1_t::__execute_a061p2(
       MD2(OutputType, aoutput2, &md3(aoutput1, _wt, 0, 0), ep.O4,
           ep.O3 * ep.O2 * V);
       MD2(BiasType, abias, bias, ep.O4, ep.O3 * ep.O2 * V);
-      MD3(TweightsType, atweights, tweights_, ep.O4, ep.I4,
+      MD3(TweightsType, atweights, numa_local(tweights_), ep.O4, ep.I4,
           ep.O3 * ep.I3 * ep.O2 * ep.I2 * V * V);
 
       gemm_a061p2(
@@ -174,7 +174,7 @@ void Instance_elx_conv_direct_1x1_t::__execute_a061p2(
       MD2(OutputType, aoutput, output, ep.n, ep.oc * ep.oh * ep.ow);
       MD2(BiasType, abias, bias, ep.O4, ep.O3 * ep.O2 * V);
       MD2(TinputType, atinput, tinput_, mthr_, ep.I3 * ep.I2 * ep.T * V);
-      MD3(TweightsType, atweights, tweights_, ep.O4, ep.I4,
+      MD3(TweightsType, atweights, numa_local(tweights_), ep.O4, ep.I4,
           ep.O3 * ep.I3 * ep.O2 * ep.I2 * V * V);
       MD2(ToutputType, atoutput, toutput_, mthr_, ep.O3 * ep.O2 * ep.T * V);
 
@@ -205,7 +205,7 @@ void Instance_elx_conv_direct_1x1_t::__execute_a061p2(
           ep.I3 * ep.I2 * ep.T * V);
       MD3(unsigned char, atinput_msk, tinput_msk_, mthr_, ep.ht, ep.wt);
       MD2(ToutputType, atoutput, toutput_, mthr_, ep.O3 * ep.O2 * ep.T * V);
-      MD3(TweightsType, atweights, tweights_, ep.O4, ep.I4,
+      MD3(TweightsType, atweights, numa_local(tweights_), ep.O4, ep.I4,
           ep.O3 * ep.I3 * ep.O2 * ep.I2 * V * V);
       int ithr = estl::current_thread_index();
 
@@ -255,7 +255,7 @@ void Instance_elx_conv_direct_1x1_t::__execute_a061p1(
       MD2(OutputType, aoutput2, &md3(aoutput1, _t2, 0, 0), ep.O4,
           ep.O3 * ep.O2 * V);
       MD2(BiasType, abias, bias, ep.O4, ep.O3 * ep.O2 * V);
-      MD3(TweightsType, atweights, tweights_, ep.O4, ep.I4,
+      MD3(TweightsType, atweights, numa_local(tweights_), ep.O4, ep.I4,
           ep.O3 * ep.I3 * ep.O2 * ep.I2 * V * V);
 
       gemm_a061p1(
@@ -271,7 +271,7 @@ void Instance_elx_conv_direct_1x1_t::__execute_a061p1(
       MD2(OutputType, aoutput, output, ep.n, ep.oc * ep.oh * ep.ow);
       MD2(BiasType, abias, bias, ep.O4, ep.O3 * ep.O2 * V);
       MD2(TinputType, atinput, tinput_, mthr_, ep.I3 * ep.I2 * ep.T * V);
-      MD3(TweightsType, atweights, tweights_, ep.O4, ep.I4,
+      MD3(TweightsType, atweights, numa_local(tweights_), ep.O4, ep.I4,
           ep.O3 * ep.I3 * ep.O2 * ep.I2 * V * V);
       MD2(ToutputType, atoutput, toutput_, mthr_, ep.O3 * ep.O2 * ep.T * V);
 
@@ -302,7 +302,7 @@ void Instance_elx_conv_direct_1x1_t::__execute_a061p1(
       MD3(TinputType, atinput, tinput_, mthr_, ep.t2,
           ep.I3 * ep.I2 * ep.T * V);
       MD2(unsigned char, atinput_msk, tinput_msk_, mthr_, ep.t2);
-      MD3(TweightsType, atweights, tweights_, ep.O4, ep.I4,
+      MD3(TweightsType, atweights, numa_local(tweights_), ep.O4, ep.I4,
           ep.O3 * ep.I3 * ep.O2 * ep.I2 * V * V);
       MD2(ToutputType, atoutput, toutput_, mthr_, ep.O3 * ep.O2 * ep.T * V);
 
@@ -2,6 +2,8 @@
 #include "el_stl.hpp"
 #include "el_utils.hpp"
 #include "el_parallel.hpp"
+#include "elx_conv_cost.hpp"
+#include "elx_post_ops.hpp"
 #include "elx_conv_direct_vmg.hpp"
 #include "elx_conv_direct_vmg_bind.hpp"
 #include "elx_conv_direct_vmg_xopt.hpp"
@@ -13,9 +15,17 @@ Instance_elx_conv_direct_vmg_t::elx_conv_direct_vmg_t(eld_conv_t &dc)
     : elx_conv_t(dc)
 {
   // user input
-  //xopt_ = ep.execution_mode;
-  xopt_ = 0xc060;
-  mthr_ = estl::max_concurrency();
+  xopt_ = ep.execution_mode;
+  if (xopt_ != 0 && !conv_xopt_supported(conv_cost_shape(dc),
+                                         CONV_DIRECT_VMG, xopt_)) {
+    el_warn("direct_vmg: execution-mode not supported, ignored");
+    xopt_ = 0;
+  }
+  if (xopt_ == 0)
+    xopt_ = conv_xopt_plan(dc, CONV_DIRECT_VMG);
+  if (xopt_ == 0)
+    xopt_ = 0xc060;
+  mthr_ = ep.nthreads;
 
   ep.G = 1;
   ep.vmg = 1;
@@ -128,7 +138,10 @@ Template_elx_conv_direct_vmg_t
 int Instance_elx_conv_direct_vmg_t::prepare_execute_opt()
 {
   if (ep.with_ip_sum && ep.with_relu && ep.output_fmt != nChw16c) {
-    el_error("Unimplemented: fuse sum (plain format) and relu together");
+    // Relu after the sum, by the post-op pass
+    if (ep.output_data_type != f32)
+      el_error("Unimplemented: fuse sum (plain format) and relu together");
+    post_ops_defer_relu(ep);
   }
 
   toutput_size_ = 0;
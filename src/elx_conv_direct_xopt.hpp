@@ -154,6 +154,8 @@ void Instance_elx_conv_direct_t::__execute_c070(
             out = _mm<V>::max_ps(out, lower);
             out = _mm<V>::min_ps(out, upper);
           }
+          if (ep.post_ops_fused)
+            out = post_ops_apply<V>(ep, out);
           if (ep.Or != V && _oc2 == ep.oc2 - 1) {
             iter_each (_V, ep.Or) {
               md2(aoutput1, _oc2, _V) = out[_V];
@@ -199,13 +201,15 @@ void Instance_elx_conv_direct_t::__execute_c070(
             out = _mm<V>::max_ps(out, lower);
             out = _mm<V>::min_ps(out, upper);
           }
+          if (ep.post_ops_fused)
+            out = post_ops_apply<V>(ep, out);
           *(__m<V> *)&md2(aoutput, o, 0) = out;
         } else {
           el_error("Unsupported data type");
         }
       }, ep.n * ep.oc2 * ep.oh * ep.ow);
     }
-  }
+  };
 
   if (is_first_run_ && inference_acc_)
     is_first_run_ = false;
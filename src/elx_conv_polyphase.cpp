@@ -0,0 +1,290 @@
+#include <string.h>
+#include <memory>
+#include "el_intrin.hpp"
+#include "el_utils.hpp"
+#include "el_stl.hpp"
+#include "el_parallel.hpp"
+#include "elx_conv.hpp"
+#include "elx_conv_polyphase.hpp"
+#include "elx_post_ops.hpp"
+
+namespace euler {
+
+// Dilated 3x3 convolution on the Winograd engine, see
+// elx_conv_polyphase.hpp. Input phases are gathered into a blocked
+// sub-input (n * Ph * Pw, IC, mh + 2, mw + 2), weights rearranged into an
+// oihw sub-kernel on first execution. With output phases the blocked
+// sub-output is scattered to the output, else the sub-convolution writes
+// the output in place.
+//
+// Scratch: sub-convolution scratch | sub-input | sub-output. Workspace is
+// the sub-convolution's, a caller workspace pad is passed on to it.
+struct elx_conv_polyphase_t : public elx_conv_t {
+  elx_conv_polyphase_t(eld_conv_t &dc);
+  virtual ~elx_conv_polyphase_t() {}
+  virtual void execute(void *output, void *input, void *weights, void *bias);
+
+  void gather_input(float *input);
+  void copy_output(float *output, bool to_sub);
+  float *sub_weights(const float *weights);
+
+  polyphase_dim_t h_, w_;
+  int IC_;
+  eld_conv_t sub_;
+  float *sub_input_, *sub_output_;
+  bool weights_done_;
+
+private:
+  virtual void set_workspace_buffers(void *base) {}
+  virtual void set_scratch_buffers(void *base);
+};
+
+elx_conv_polyphase_t::elx_conv_polyphase_t(eld_conv_t &dc)
+    : elx_conv_t(dc), sub_input_(nullptr), sub_output_(nullptr),
+      weights_done_(false)
+{
+  // The sub-convolution folds batch norm and applies post-ops
+  delete fold_;
+  fold_ = nullptr;
+  ep.with_bias = dc.with_bias;
+  ep.post_ops.clear();
+  ep.sum_scale = 1.f;
+
+  polyphase_dim_init(h_, dc.dims.ih, dc.dims.oh, dc.dims.kh, dc.strides.h,
+                     dc.dilations.h, dc.pads.t);
+  polyphase_dim_init(w_, dc.dims.iw, dc.dims.ow, dc.dims.kw, dc.strides.w,
+                     dc.dilations.w, dc.pads.l);
+  IC_ = ALIGNUP(dc.dims.ic, 16);
+
+  conv_desc_clone(sub_, dc);
+  sub_.dims = { dc.dims.n * h_.P * w_.P, 1, IC_, dc.dims.oc,
+                h_.m + 2, w_.m + 2, h_.m, w_.m, 3, 3 };
+  sub_.pads = { 0, 0, 0, 0 };
+  sub_.strides = { 1, 1 };
+  sub_.dilations = { 1, 1 };
+  sub_.formats.input = nChw16c;
+  sub_.formats.weights = oihw;
+  if (h_.P * w_.P > 1)
+    sub_.formats.output = nChw16c;
+  sub_.algorithm = CONV_WINOGRAD;
+  sub_.name = dc.name + ".polyphase";
+
+  if (sub_.setup() != ELD_OK || sub_.xc == nullptr) {
+    el_error("Polyphase: sub-convolution setup failed");
+    return;
+  }
+  scratch_size_ = alignup(sub_.byte_sizes.scratch, 64)
+      + alignup(sub_.byte_sizes.input, 64)
+      + (h_.P * w_.P > 1 ? sub_.byte_sizes.output : 0);
+  workspace_size_ = sub_.byte_sizes.workspace;
+
+  el_log(__DEBUG, "Polyphase: %s: phases %dx%d, sub-conv n=%d ic=%d %dx%d",
+         ep.name.c_str(), h_.P, w_.P, sub_.dims.n, sub_.dims.ic,
+         sub_.dims.oh, sub_.dims.ow);
+}
+
+void elx_conv_polyphase_t::set_scratch_buffers(void *base)
+{
+  char *p = (char *)base;
+  sub_.use_scratch_pad = sub_.byte_sizes.scratch > 0;
+  sub_.scratch_pad = sub_.use_scratch_pad ? p : nullptr;
+  p += alignup(sub_.byte_sizes.scratch, 64);
+  sub_input_ = (float *)p;
+  p += alignup(sub_.byte_sizes.input, 64);
+  sub_output_ = h_.P * w_.P > 1 ? (float *)p : nullptr;
+}
+
+// Offset of element (c, h, w) in an image of C channels, H x W
+static inline size_t image_offset(int fmt, int C, int H, int W, int c,
+                                  int h, int w)
+{
+  switch (fmt) {
+  case nhwc:
+    return ((size_t)h * W + w) * C + c;
+  case nChw16c:
+    return (((size_t)(c / 16) * H + h) * W + w) * 16 + c % 16;
+  case nChw8c:
+    return (((size_t)(c / 8) * H + h) * W + w) * 8 + c % 8;
+  default: // nchw
+    return ((size_t)c * H + h) * W + w;
+  }
+}
+
+// 16 channels from c of pixel at p in an image, 0 past C
+static inline __m512 load_channels(int fmt, int C, int H, int W,
+                                   const float *p, int c)
+{
+  __mmask16 k = C - c >= 16 ? 0xffff : (1 << (C - c)) - 1;
+  switch (fmt) {
+  case nhwc:
+  case nChw16c:
+    return _mm512_maskz_loadu_ps(k, p);
+  default: {
+    size_t stride = fmt == nchw ? (size_t)H * W : 0;
+    __m512 v = _mm512_setzero_ps();
+    alignas(64) float buf[16];
+    if (fmt == nChw8c) {
+      _mm512_store_ps(buf, v);
+      for (int i = 0; i < 16 && c + i < C; ++i)
+        buf[i] = p[image_offset(nChw8c, C, H, W, c + i, 0, 0)
+                   - image_offset(nChw8c, C, H, W, c, 0, 0)];
+      return _mm512_load_ps(buf);
+    }
+    __m512i vindex = _mm512_mullo_epi32(
+        _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0),
+        _mm512_set1_epi32((int)stride));
+    return _mm512_mask_i32gather_ps(v, k, vindex, p, 4);
+  }
+  }
+}
+
+static inline void store_channels(int fmt, int C, int H, int W, float *p,
+                                  int c, __m512 v)
+{
+  __mmask16 k = C - c >= 16 ? 0xffff : (1 << (C - c)) - 1;
+  switch (fmt) {
+  case nhwc:
+  case nChw16c:
+    _mm512_mask_storeu_ps(p, k, v);
+    break;
+  default: {
+    alignas(64) float buf[16];
+    _mm512_store_ps(buf, v);
+    size_t base = image_offset(fmt, C, H, W, c, 0, 0);
+    for (int i = 0; i < 16 && c + i < C; ++i)
+      p[image_offset(fmt, C, H, W, c + i, 0, 0) - base] = buf[i];
+    break;
+  }
+  }
+}
+
+void elx_conv_polyphase_t::gather_input(float *input)
+{
+  int n = ep.n, C = ep.ic, H = ep.ih, W = ep.iw;
+  int sh = sub_.dims.ih, sw = sub_.dims.iw;
+  int C2 = IC_ / 16;
+  size_t image = (size_t)H * W * (estl::any_of(ep.input_fmt, nChw16c, nChw8c)
+                                  ? ALIGNUP(C, ep.input_fmt == nChw8c ? 8 : 16)
+                                  : C);
+  // sub-input: n, Ph, Pw, C2, sh, sw, 16
+  estl::parallel_for<4>([&](int _n, int _r, int _c2, int _j) {
+    int _rh = _r / w_.P, _rw = _r % w_.P;
+    float *dst = sub_input_
+        + ((((size_t)_n * h_.P * w_.P + _r) * C2 + _c2) * sh + _j)
+          * sw * 16;
+    const float *src = input + _n * image;
+    int _ih = h_.src(_j, _rh);
+    iter_each (_i, sw) {
+      int _iw = w_.src(_i, _rw);
+      __m512 v = _mm512_setzero_ps();
+      if (_ih >= 0 && _ih < H && _iw >= 0 && _iw < W && _c2 * 16 < C)
+        v = load_channels(ep.input_fmt, C, H, W,
+                          src + image_offset(ep.input_fmt, C, H, W,
+                                             _c2 * 16, _ih, _iw), _c2 * 16);
+      _mm512_store_ps(dst + (size_t)_i * 16, v);
+    }
+  }, n, h_.P * w_.P, C2, sh);
+}
+
+// Blocked sub-output (n, Ph, Pw, OC2, mh, mw, 16) to/from output phases
+void elx_conv_polyphase_t::copy_output(float *output, bool to_sub)
+{
+  int n = ep.n, C = ep.oc, H = ep.oh, W = ep.ow;
+  int mh = h_.m, mw = w_.m, OC2 = ALIGNUP(C, 16) / 16;
+  size_t image = (size_t)H * W * (estl::any_of(ep.output_fmt, nChw16c,
+                                               nChw8c)
+                                  ? ALIGNUP(C, ep.output_fmt == nChw8c
+                                            ? 8 : 16)
+                                  : C);
+  estl::parallel_for<4>([&](int _n, int _r, int _c2, int _m) {
+    int _rh = _r / w_.P, _rw = _r % w_.P;
+    int _oh = _m * h_.d + _rh;
+    if (_oh >= H)
+      return;
+    float *sub = sub_output_
+        + ((((size_t)_n * h_.P * w_.P + _r) * OC2 + _c2) * mh + _m) * mw * 16;
+    float *out = output + _n * image;
+    iter_each (_i, mw) {
+      int _ow = _i * w_.d + _rw;
+      if (_ow >= W)
+        break;
+      float *p = out + image_offset(ep.output_fmt, C, H, W, _c2 * 16, _oh,
+                                    _ow);
+      if (to_sub)
+        _mm512_store_ps(sub + (size_t)_i * 16,
+                        load_channels(ep.output_fmt, C, H, W, p, _c2 * 16));
+      else
+        store_channels(ep.output_fmt, C, H, W, p, _c2 * 16,
+                       _mm512_load_ps(sub + (size_t)_i * 16));
+    }
+  }, n, h_.P * w_.P, OC2, mh);
+}
+
+// oihw sub-kernel (oc, IC, 3, 3) of user weights, polyphase_supported
+// formats
+float *elx_conv_polyphase_t::sub_weights(const float *weights)
+{
+  int oc = ep.oc, ic = ep.ic, K = 3;
+  int I2 = ALIGNUP(ic, 16) / 16;
+  float *w;
+  if (memalign64(&w, sub_.byte_sizes.weights) != 0) {
+    el_error("Polyphase: weights allocation failed");
+    return nullptr;
+  }
+  memset(w, 0, sub_.byte_sizes.weights);
+
+  auto user = [&](int _o, int _i, int _kh, int _kw) -> float {
+    switch (ep.weights_fmt) {
+    case hwio:
+      return weights[(((size_t)_kh * K + _kw) * ic + _i) * oc + _o];
+    case OIhw16i16o:
+      return weights[((((size_t)(_o / 16) * I2 + _i / 16) * K + _kh) * K
+                      + _kw) * 256 + (_i % 16) * 16 + _o % 16];
+    default: // oihw
+      return weights[(((size_t)_o * ic + _i) * K + _kh) * K + _kw];
+    }
+  };
+
+  estl::parallel_for<2>([&](int _o, int _i) {
+    float *dst = w + ((size_t)_o * IC_ + _i) * 9;
+    iter_each (_kh, 3) {
+      iter_each (_kw, 3)
+        dst[_kh * 3 + _kw] = user(_o, _i, _kh, _kw);
+    }
+  }, oc, ic);
+  return w;
+}
+
+void elx_conv_polyphase_t::execute(void *output, void *input, void *weights,
+                                   void *bias)
+{
+  // Sub-kernel feeds the first-run weights transform only
+  float *w = nullptr;
+  if (!weights_done_)
+    w = sub_weights((float *)weights);
+
+  // Caller workspace goes to the sub-convolution, else it owns its own
+  sub_.use_workspace_pad = ep.use_workspace_pad;
+  sub_.workspace_pad = ep.workspace_pad;
+
+  gather_input((float *)input);
+  bool phases = h_.P * w_.P > 1;
+  if (phases && ep.with_ip_sum)
+    copy_output((float *)output, true);
+  elx_conv(sub_, phases ? (void *)sub_output_ : output, sub_input_,
+           w != nullptr ? w : weights, bias);
+  if (phases)
+    copy_output((float *)output, false);
+
+  if (w != nullptr) {
+    ::free(w);
+    weights_done_ = true;
+  }
+}
+
+elx_conv_t *create_elx_conv_polyphase(eld_conv_t &dc)
+{
+  return new elx_conv_polyphase_t(dc);
+}
+
+}  // namespace euler
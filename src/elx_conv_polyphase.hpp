@@ -0,0 +1,59 @@
+#pragma once
+
+#include "euler.hpp"
+
+namespace euler {
+
+// Polyphase decomposition of a dilated 3x3 convolution
+//
+// Per dimension, dilation d splits the output in d phases r:
+//   out[d * i + r] = sum_k w[k] * in[d * (i + k) + r - p],
+// a stride-1 convolution over the input subsampled by d from r - p.
+// Output phases go to the batch of one stride-1, pad-0 3x3 convolution
+// run by the Winograd engine.
+//
+// Strides are not decomposed: input phase q of stride s sees a kernel of
+// ceil((3 - q) / s) taps, zero padded to 3 on an engine of F(m, 3) and
+// up, i.e. s * s times the multiplies of the strided 3x3 itself, which
+// then runs on the direct engines.
+struct polyphase_dim_t {
+  int P; // output phases
+  int m; // sub-convolution output length, input length m + 2
+  int d, p;
+
+  // User input index of sub-input j of output phase r
+  inline int src(int j, int r) const {
+    return d * j + r - p;
+  }
+};
+
+// False if dimension (input, output, kernel, stride, dilation, pad) does
+// not decompose
+static inline bool polyphase_dim_init(polyphase_dim_t &pd, int i, int o,
+                                      int k, int s, int d, int p)
+{
+  if (k != 3 || s != 1 || d < 1)
+    return false;
+  pd.d = d;
+  pd.p = p;
+  pd.P = d;
+  pd.m = (o + d - 1) / d;
+  return true;
+}
+
+// Shape is dilated, decomposes, and weights are in a format the
+// sub-kernel is gathered from
+static inline bool polyphase_supported(const eld_conv_t &desc)
+{
+  polyphase_dim_t h, w;
+  return (desc.dilations.h != 1 || desc.dilations.w != 1)
+      && desc.dims.g == 1
+      && (desc.formats.weights == oihw || desc.formats.weights == hwio
+          || desc.formats.weights == OIhw16i16o)
+      && polyphase_dim_init(h, desc.dims.ih, desc.dims.oh, desc.dims.kh,
+                            desc.strides.h, desc.dilations.h, desc.pads.t)
+      && polyphase_dim_init(w, desc.dims.iw, desc.dims.ow, desc.dims.kw,
+                            desc.strides.w, desc.dilations.w, desc.pads.l);
+}
+
+}  // namespace euler
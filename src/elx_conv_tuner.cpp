@@ -0,0 +1,418 @@
+#include <string.h>
+#include <float.h>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include "el_def.hpp"
+#include "el_utils.hpp"
+#include "el_stl.hpp"
+#include "el_parallel.hpp"
+#include "elx_conv.hpp"
+#include "elx_conv_tuner.hpp"
+#include "kernel/elk_def.hpp"
+
+namespace euler {
+
+// Timed runs per candidate, after one warm-up run (weights transform)
+#define AUTO_TUNE_ITERS (3)
+// Max coordinate descent passes over (xopt, T, O, I2, I4, O4)
+#define AUTO_TUNE_PASSES (2)
+// Improvement (ratio) required to switch to a candidate
+#define AUTO_TUNE_MIN_GAIN (0.02f)
+
+static inline bool kgemm_ok(int O, int T) {
+  return O >= 1 && O <= (int)estl::size(kgemm_max_T)
+      && T >= 1 && T <= kgemm_max_T[O - 1];
+}
+
+static inline bool kconv_ok(int O, int T) {
+  return O >= 1 && O <= kconv_max_O && T >= 1 && T <= kconv_max_T;
+}
+
+struct tune_point_t {
+  int xopt, O, T, I2, I4, O4;
+
+  bool operator==(const tune_point_t &p) const {
+    return xopt == p.xopt && O == p.O && T == p.T
+        && I2 == p.I2 && I4 == p.I4 && O4 == p.O4;
+  }
+};
+
+class elx_conv_tuner_t {
+public:
+  elx_conv_tuner_t(eld_conv_t &dc);
+  ~elx_conv_tuner_t();
+
+  bool supported() { return !xopts_.empty(); }
+  bool has_xopt(int xopt) {
+    return std::find(xopts_.begin(), xopts_.end(), xopt) != xopts_.end();
+  }
+  int tune();
+
+private:
+  bool valid(const tune_point_t &p);
+  bool repair(tune_point_t &p);
+  float measure(const tune_point_t &p);
+  void apply(const tune_point_t &p);
+
+  bool wino_valid(const tune_point_t &p);
+  bool direct_valid(const tune_point_t &p);
+  bool direct_1x1_valid(const tune_point_t &p);
+
+  eld_conv_t &dc_;
+  const int V = 16;
+  int ic_, oc_, ic2_, oc2_, lp_, rp_, tp_, bp_;
+  // wino tiles
+  int t_;
+  std::vector<int> xopts_;
+  tune_point_t start_;
+
+  void *input_, *weights_, *output_, *bias_;
+};
+
+elx_conv_tuner_t::elx_conv_tuner_t(eld_conv_t &dc) : dc_(dc)
+{
+  input_ = weights_ = output_ = bias_ = nullptr;
+
+  ic_ = dc.dims.ic / dc.dims.g;
+  oc_ = dc.dims.oc / dc.dims.g;
+  ic2_ = ALIGNUP(ic_, V) / V;
+  oc2_ = ALIGNUP(oc_, V) / V;
+  lp_ = dc.pads.l;
+  tp_ = dc.pads.t;
+  // Same as elx_conv_t
+  rp_ = estl::max(0, dc.strides.w * (dc.dims.ow - 1) + dc.dims.kw
+      - dc.dims.iw - lp_);
+  bp_ = estl::max(0, dc.strides.h * (dc.dims.oh - 1) + dc.dims.kh
+      - dc.dims.ih - tp_);
+  t_ = 0;
+
+  using dt = decltype(dc.data_type);
+  if (dc.data_type.flat != dt{ { { f32, f32, f32, f32 } } }.flat) {
+    el_log(__INFO, "auto-tune: %s: user data type not supported",
+           dc.name.c_str());
+    return;
+  }
+
+  bool in_bfmt = dc.formats.input == nChw16c;
+  bool wei_bfmt = estl::any_of(dc.formats.weights, OIhw16i16o, gOIhw16i16o);
+  bool out_bfmt = dc.formats.output == nChw16c;
+  bool nhwc_io = dc.formats.input == nhwc && dc.formats.output == nhwc;
+
+  start_ = { 0, 1, 1, 1, 1, 1 };
+
+  switch (dc.algorithm) {
+  case CONV_WINOGRAD: {
+    if ((dc.execution_mode & 0xF00) == 0x100)
+      break; // int8 impl.
+    const int A = dc.tile_size, K = dc.dims.kh;
+    int ht = (dc.dims.oh + A - K) / (A - K + 1);
+    int wt = (dc.dims.ow + A - K) / (A - K + 1);
+    t_ = dc.dims.n * ht * wt;
+    for (int xopt : { 0xa033, 0xa061, 0xa071, 0xa073 }) {
+      if (xopt == 0xa073 && dc.with_relu && !out_bfmt)
+        continue;
+      xopts_.push_back(xopt);
+    }
+    start_.xopt = 0xa061;
+    start_.T = estl::min(t_, 18);
+    break;
+  }
+  case CONV_DIRECT: {
+    bool conv_shape_ok = estl::any_of(dc.dims.kh, 3, 5, 7)
+        && estl::any_of(dc.dims.kw, 3, 5, 7)
+        && estl::any_of(dc.strides.w, 1, 2)
+        && estl::any_of(lp_, dc.dims.kw / 2 - 1, dc.dims.kw / 2)
+        && estl::any_of(rp_, dc.dims.kw / 2 - 1, dc.dims.kw / 2)
+        && estl::any_of(tp_, dc.dims.kh / 2 - 1, dc.dims.kh / 2)
+        && estl::any_of(bp_, dc.dims.kh / 2 - 1, dc.dims.kh / 2);
+    bool fmt_ok = estl::any_of(dc.formats.weights,
+        hwio, ghwio, OIhw16i16o, gOIhw16i16o);
+    bool blocked_io = in_bfmt && out_bfmt;
+    bool first_conv = dc.dims.g == 1 && ic_ < V;
+
+    if (fmt_ok && conv_shape_ok && (nhwc_io || (out_bfmt
+        && estl::any_of(dc.formats.input, nchw, nChw16c))))
+      xopts_.push_back(0xc060);
+    if (!first_conv && dc.dims.g == 1 && fmt_ok && conv_shape_ok
+        && (nhwc_io || blocked_io))
+      xopts_.push_back(0xc070);
+    if (!first_conv && fmt_ok && estl::any_of(dc.strides.w, 1, 2)
+        && (nhwc_io || blocked_io))
+      xopts_.push_back(0xa060);
+    // Group conv: keep default xopt only
+    if (dc.dims.g > 1 && !xopts_.empty())
+      xopts_.resize(1);
+    start_.xopt = estl::any_of(dc.dims.kw, 3, 5, 7) ? 0xc060 : 0xa060;
+    start_.T = estl::min(dc.dims.ow, 14);
+    break;
+  }
+  case CONV_DIRECT_1X1: {
+    bool no_pad = lp_ == 0 && rp_ == 0 && tp_ == 0 && bp_ == 0;
+    bool unit_stride = dc.strides.h == 1 && dc.strides.w == 1;
+    bool strided_ok = dc.dims.oh * dc.strides.h == dc.dims.ih
+        && dc.dims.ow * dc.strides.w == dc.dims.iw;
+    if (in_bfmt && wei_bfmt && out_bfmt) {
+      if (no_pad && unit_stride)
+        xopts_.push_back(0xa060);
+      if (no_pad && strided_ok)
+        xopts_.push_back(0xa061);
+      start_.xopt = unit_stride ? 0xa060 : 0xa061;
+    } else {
+      if (no_pad && unit_stride)
+        xopts_.push_back(0xa062);
+      xopts_.push_back(0xa063);
+      start_.xopt = unit_stride ? 0xa062 : 0xa063;
+    }
+    start_.T = estl::min(dc.dims.ow, 14);
+    start_.I2 = ic2_;
+    break;
+  }
+  default:
+    break;
+  }
+
+  if (xopts_.empty()) {
+    el_log(__INFO, "auto-tune: %s: algorithm/shape not supported",
+           dc.name.c_str());
+    return;
+  }
+
+  // User execution-mode pins xopt
+  if (dc.execution_mode != 0) {
+    bool found = has_xopt(dc.execution_mode);
+    xopts_.clear();
+    if (found)
+      xopts_.push_back(dc.execution_mode);
+  }
+  if (xopts_.empty())
+    return;
+  if (!has_xopt(start_.xopt))
+    start_.xopt = xopts_[0];
+
+  memalign64(&input_, dc.byte_sizes.input);
+  memalign64(&weights_, dc.byte_sizes.weights);
+  memalign64(&output_, dc.byte_sizes.output);
+  memalign64(&bias_, dc.byte_sizes.bias);
+  memset(input_, 0, dc.byte_sizes.input);
+  memset(weights_, 0, dc.byte_sizes.weights);
+  memset(output_, 0, dc.byte_sizes.output);
+  memset(bias_, 0, dc.byte_sizes.bias);
+}
+
+elx_conv_tuner_t::~elx_conv_tuner_t()
+{
+  ::free(input_);
+  ::free(weights_);
+  ::free(output_);
+  ::free(bias_);
+}
+
+bool elx_conv_tuner_t::wino_valid(const tune_point_t &p)
+{
+  int Tr = t_ % p.T ? t_ % p.T : p.T;
+  if (p.T > t_ || !kgemm_ok(p.O, p.T) || !kgemm_ok(p.O, Tr))
+    return false;
+  if (p.I4 > 1 && (!(p.xopt & FUS_I) || ic_ % V != 0))
+    return false;
+  if (p.O4 > 1 && (!(p.xopt & FUS_O) || oc_ % V != 0))
+    return false;
+  return ic2_ % (p.I2 * p.I4) == 0 && oc2_ % (p.O * p.O4) == 0;
+}
+
+bool elx_conv_tuner_t::direct_valid(const tune_point_t &p)
+{
+  const int ow = dc_.dims.ow;
+  int wt = (ow + p.T - 1) / p.T;
+  int Tr = ow % p.T ? ow % p.T : p.T;
+  if (p.T > ow)
+    return false;
+  if (p.xopt == 0xc060 || p.xopt == 0xc070) {
+    if (!kconv_ok(p.O, p.T) || p.T < lp_ || Tr < rp_)
+      return false;
+  } else { // a060
+    if (!kgemm_ok(p.O, p.T) || wt > 128 || p.T <= lp_ || Tr <= rp_)
+      return false;
+  }
+  // I4 partition: c070 only
+  if (p.I4 > 1 && (p.xopt != 0xc070 || ic_ % V != 0))
+    return false;
+  // No oc tailing
+  return ic2_ % (p.I2 * p.I4) == 0 && oc2_ % (p.O * p.O4) == 0;
+}
+
+bool elx_conv_tuner_t::direct_1x1_valid(const tune_point_t &p)
+{
+  const int ow = dc_.dims.ow;
+  const int nt = dc_.dims.oh * ow;
+  if (p.xopt == 0xa061 || p.xopt == 0xa063) {
+    // No Tr support
+    if (ow % p.T != 0 || !kgemm_ok(p.O, p.T))
+      return false;
+  } else { // a060, b061
+    int Tr = nt % p.T ? nt % p.T : p.T;
+    if (p.T > nt || !kgemm_ok(p.O, p.T) || !kgemm_ok(p.O, Tr))
+      return false;
+  }
+  if (p.I4 > 1 && (estl::any_of(p.xopt, 0xa062, 0xa063) || ic_ % V != 0))
+    return false;
+  if (p.O4 > 1 && oc_ % V != 0)
+    return false;
+  return ic2_ % (p.I2 * p.I4) == 0 && oc2_ % (p.O * p.O4) == 0;
+}
+
+bool elx_conv_tuner_t::valid(const tune_point_t &p)
+{
+  if (!has_xopt(p.xopt))
+    return false;
+  if (p.O < 1 || p.T < 1 || p.I2 < 1 || p.I4 < 1 || p.O4 < 1)
+    return false;
+
+  switch (dc_.algorithm) {
+  case CONV_WINOGRAD: return wino_valid(p);
+  case CONV_DIRECT: return direct_valid(p);
+  case CONV_DIRECT_1X1: return direct_1x1_valid(p);
+  default: return false;
+  }
+}
+
+// Lower T until p is valid, e.g. after a xopt change
+bool elx_conv_tuner_t::repair(tune_point_t &p)
+{
+  for (int T = p.T; T >= 1; --T) {
+    tune_point_t q = p;
+    q.T = T;
+    if (valid(q)) {
+      p = q;
+      return true;
+    }
+  }
+  return false;
+}
+
+void elx_conv_tuner_t::apply(const tune_point_t &p)
+{
+  dc_.execution_mode = p.xopt;
+  dc_.flatting = { p.O, p.T };
+  dc_.blocking = { p.I2, 1 };
+  dc_.partition = { p.I4, p.O4, dc_.partition.g };
+}
+
+float elx_conv_tuner_t::measure(const tune_point_t &p)
+{
+  typedef std::chrono::high_resolution_clock hrc;
+  typedef std::chrono::duration<float, std::milli> hrc_duration;
+
+  apply(p);
+  elx_conv_t *xc = create_elx_conv(dc_);
+  if (xc == nullptr)
+    return FLT_MAX;
+  // Candidates own private workspace
+  xc->ep.shared_workspace_enabled = false;
+  xc->set_scratch_buffers();
+
+  float best = FLT_MAX;
+  estl::team_run(xc->ep.nthreads, [&]() {
+    // Warm-up, weights transform
+    xc->execute(output_, input_, weights_, bias_);
+
+    iter_each (i, AUTO_TUNE_ITERS) {
+      hrc::time_point start_ts = hrc::now();
+      xc->execute(output_, input_, weights_, bias_);
+      best = estl::min(best, hrc_duration(hrc::now() - start_ts).count());
+    }
+  });
+  delete xc;
+
+  el_log(__DEBUG, "auto-tune: %s: xopt=%x, O=%d, T=%d, I2=%d, I4=%d, O4=%d, "
+         "%.3f ms", dc_.name.c_str(), p.xopt, p.O, p.T, p.I2, p.I4, p.O4,
+         best);
+  return best;
+}
+
+int elx_conv_tuner_t::tune()
+{
+  tune_point_t best = start_;
+  if (!valid(best) && !repair(best)) {
+    el_log(__INFO, "auto-tune: %s: no valid start point", dc_.name.c_str());
+    return ELD_UNIMPLEMENTED;
+  }
+
+  // Candidate engines run synchronously in caller thread
+  bool eager_mode = dc_.eager_mode;
+  dc_.eager_mode = true;
+
+  float best_time = measure(best);
+
+  auto try_point = [&](tune_point_t p, bool fix_T) -> bool {
+    if (p == best)
+      return false;
+    if (!valid(p) && !(fix_T && repair(p)))
+      return false;
+    float t = measure(p);
+    if (t < best_time * (1.0f - AUTO_TUNE_MIN_GAIN)) {
+      best = p;
+      best_time = t;
+      return true;
+    }
+    return false;
+  };
+
+  std::vector<int> tdomain, odomain, idomain, o4domain;
+  for (int T = 1; T <= kgemm_max_T[0]; ++T)
+    tdomain.push_back(T);
+  for (int O = 1; O <= (int)estl::size(kgemm_max_T); ++O)
+    odomain.push_back(O);
+  for (int d = 1; d <= ic2_; ++d)
+    if (ic2_ % d == 0) idomain.push_back(d);
+  for (int d = 1; d <= oc2_; ++d)
+    if (oc2_ % d == 0) o4domain.push_back(d);
+
+  iter_each (pass, AUTO_TUNE_PASSES) {
+    bool improved = false;
+    for (int xopt : xopts_) {
+      tune_point_t p = best; p.xopt = xopt;
+      improved |= try_point(p, true);
+    }
+    for (int T : tdomain) {
+      tune_point_t p = best; p.T = T;
+      improved |= try_point(p, false);
+    }
+    for (int O : odomain) {
+      tune_point_t p = best; p.O = O;
+      improved |= try_point(p, true);
+    }
+    for (int I2 : idomain) {
+      tune_point_t p = best; p.I2 = I2;
+      improved |= try_point(p, false);
+    }
+    for (int I4 : idomain) {
+      tune_point_t p = best; p.I4 = I4;
+      improved |= try_point(p, false);
+    }
+    for (int O4 : o4domain) {
+      tune_point_t p = best; p.O4 = O4;
+      improved |= try_point(p, false);
+    }
+    if (!improved)
+      break;
+  }
+
+  apply(best);
+  dc_.eager_mode = eager_mode;
+
+  el_log(__INFO, "auto-tune: %s: xopt=%x, O=%d, T=%d, I2=%d, I4=%d, O4=%d, "
+         "%.3f ms", dc_.name.c_str(), best.xopt, best.O, best.T, best.I2,
+         best.I4, best.O4, best_time);
+  return ELD_OK;
+}
+
+int elx_conv_auto_tune(eld_conv_t &desc)
+{
+  elx_conv_tuner_t tuner(desc);
+  if (!tuner.supported())
+    return ELD_UNIMPLEMENTED;
+  return tuner.tune();
+}
+
+}  // namespace euler
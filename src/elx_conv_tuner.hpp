@@ -0,0 +1,18 @@
+#pragma once
+
+#include "euler.hpp"
+
+namespace euler {
+
+// Runtime auto-tuning
+//
+// Benchmark candidate (xopt, O, T, I2, I4, O4) tuples for the shape and
+// thread count of a set-up descriptor and write the fastest one back to
+// desc.execution_mode/flatting/blocking/partition. A non-zero user
+// execution_mode pins xopt. Shapes/types not supported by the tuner
+// keep user settings.
+//
+// Supported: fp32 CONV_WINOGRAD, CONV_DIRECT, CONV_DIRECT_1X1
+int elx_conv_auto_tune(eld_conv_t &desc);
+
+}  // namespace euler
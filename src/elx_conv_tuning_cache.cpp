@@ -0,0 +1,207 @@
+#include <stdio.h>
+#include <string.h>
+#include <mutex>
+#include <unordered_map>
+#include "el_def.hpp"
+#include "el_isa.hpp"
+#include "el_utils.hpp"
+#include "el_init.hpp"
+#include "el_parallel.hpp"
+#include "el_allocator.hpp"
+#include "elx_conv_tuning_cache.hpp"
+
+namespace euler {
+
+#define TUNING_CACHE_FILE "euler_tuning_cache.txt"
+// Bump on any change of key/value layout
+#define TUNING_CACHE_LAYOUT "euler-tuning-cache-v2"
+
+struct tuning_cache_entry_t {
+  int algorithm;
+  int execution_mode;
+  int flatting_o, flatting_t;
+  int blocking_i, blocking_o;
+  int partition_i, partition_o, partition_g;
+  int tile_size, f16c_opt;
+  int streaming_input, streaming_output;
+};
+
+struct tuning_cache_t {
+  std::mutex mu;
+  bool loaded = false;
+  std::unordered_map<std::string, tuning_cache_entry_t> entries;
+};
+
+static tuning_cache_t &tuning_cache() {
+  static tuning_cache_t cache;
+  return cache;
+}
+
+static inline std::string tuning_cache_path() {
+  return std::string(ego.tuning_cache_dir) + "/" + TUNING_CACHE_FILE;
+}
+
+static inline const char *isa_to_string() {
+#if defined(WITH_VNNI)
+  if (cpu_has(avx512_core_vnni))
+    return "avx512_core_vnni";
+#endif
+  if (cpu_has(avx512_core))
+    return "avx512_core";
+  if (cpu_has(avx512_common))
+    return "avx512_common";
+  if (cpu_has(avx2))
+    return "avx2";
+  return "generic";
+}
+
+static inline bool parse_entry(const char *line, std::string &key,
+                               tuning_cache_entry_t &e) {
+  char kbuf[512];
+  int n = sscanf(line, "%511s %d %x %d %d %d %d %d %d %d %d %d %d %d",
+                 kbuf, &e.algorithm, &e.execution_mode, &e.flatting_o,
+                 &e.flatting_t, &e.blocking_i, &e.blocking_o,
+                 &e.partition_i, &e.partition_o, &e.partition_g,
+                 &e.tile_size, &e.f16c_opt, &e.streaming_input,
+                 &e.streaming_output);
+  if (n != 14)
+    return false;
+  key = kbuf;
+  return true;
+}
+
+// Caller holds cache.mu
+static void load_tuning_cache(tuning_cache_t &cache) {
+  cache.loaded = true;
+  FILE *fp = fopen(tuning_cache_path().c_str(), "r");
+  if (fp == nullptr)
+    return;
+
+  char line[1024];
+  if (fgets(line, sizeof(line), fp) == nullptr
+      || strncmp(line, TUNING_CACHE_LAYOUT, strlen(TUNING_CACHE_LAYOUT))) {
+    el_log(__WARN, "tuning-cache: %s: layout mismatch, ignored",
+           tuning_cache_path().c_str());
+    fclose(fp);
+    return;
+  }
+
+  std::string key;
+  tuning_cache_entry_t e;
+  while (fgets(line, sizeof(line), fp) != nullptr) {
+    if (parse_entry(line, key, e))
+      cache.entries[key] = e;
+  }
+  fclose(fp);
+}
+
+bool tuning_cache_enabled() {
+  return ego.tuning_cache_dir != nullptr;
+}
+
+std::string tuning_cache_key(const eld_conv_t &desc) {
+  int nthreads = desc.nthreads;
+  auto mthr = estl::max_concurrency();
+  if (nthreads == 0 || nthreads > mthr)
+    nthreads = mthr;
+
+  char buf[512];
+  snprintf(buf, sizeof(buf),
+           "%d:%d:%d:%d:%d:%d:%d:%d:%d:%d"  // dims
+           ",%d:%d:%d:%d,%d:%d,%d:%d"       // pads, strides, dilations
+           ",%s,%s:%s:%s,%s:%s:%s:%s"       // algorithm, formats, types
+           ",%d%d%d%d%d%d,%x:%d:%g,%s,%d,%s",
+           desc.dims.n, desc.dims.g, desc.dims.ic, desc.dims.oc,
+           desc.dims.ih, desc.dims.iw, desc.dims.oh, desc.dims.ow,
+           desc.dims.kh, desc.dims.kw,
+           desc.pads.l, desc.pads.r, desc.pads.t, desc.pads.b,
+           desc.strides.h, desc.strides.w,
+           desc.dilations.h, desc.dilations.w,
+           algorithm_to_string(desc.algorithm),
+           format_to_string(desc.formats.input),
+           format_to_string(desc.formats.weights),
+           format_to_string(desc.formats.output),
+           datatype_to_string(desc.data_type.input),
+           datatype_to_string(desc.data_type.weights),
+           datatype_to_string(desc.data_type.output),
+           datatype_to_string(desc.data_type.bias),
+           desc.with_relu, desc.with_bias, desc.with_ip_sum,
+           desc.with_op_sum, desc.with_argmax, desc.f16c_opt,
+           desc.execution_mode, desc.tile_size, desc.wino_error_budget,
+           isa_to_string(), nthreads, XSTRINGIFY(EULER_VERSION));
+  return std::string(buf);
+}
+
+bool tuning_cache_load(const std::string &key, eld_conv_t &desc) {
+  auto &cache = tuning_cache();
+  std::lock_guard<std::mutex> lock(cache.mu);
+  if (!cache.loaded) {
+    const std::string lock_path = tuning_cache_path() + ".lock";
+    process_singleton_t process_singleton(lock_path.c_str());
+    load_tuning_cache(cache);
+  }
+
+  auto it = cache.entries.find(key);
+  if (it == cache.entries.end())
+    return false;
+
+  auto &e = it->second;
+  desc.algorithm = e.algorithm;
+  desc.execution_mode = e.execution_mode;
+  desc.flatting = { e.flatting_o, e.flatting_t };
+  desc.blocking = { e.blocking_i, e.blocking_o };
+  desc.partition = { e.partition_i, e.partition_o, e.partition_g };
+  desc.tile_size = e.tile_size;
+  desc.f16c_opt = e.f16c_opt;
+  desc.streaming_hint = { e.streaming_input, e.streaming_output };
+
+  el_log(__INFO, "tuning-cache: %s: hit, xopt=%x", desc.name.c_str(),
+         e.execution_mode);
+  return true;
+}
+
+void tuning_cache_store(const std::string &key, const eld_conv_t &desc) {
+  tuning_cache_entry_t e = {
+    desc.algorithm,
+    desc.execution_mode,
+    desc.flatting.o, desc.flatting.t,
+    desc.blocking.i, desc.blocking.o,
+    desc.partition.i, desc.partition.o, desc.partition.g,
+    desc.tile_size, desc.f16c_opt,
+    desc.streaming_hint.input, desc.streaming_hint.output
+  };
+
+  auto &cache = tuning_cache();
+  std::lock_guard<std::mutex> lock(cache.mu);
+  cache.entries[key] = e;
+
+  const std::string path = tuning_cache_path();
+  const std::string lock_path = path + ".lock";
+  process_singleton_t process_singleton(lock_path.c_str());
+
+  // Start a new file on layout mismatch
+  bool layout_ok = false;
+  FILE *fp = fopen(path.c_str(), "r");
+  if (fp != nullptr) {
+    char line[1024];
+    layout_ok = fgets(line, sizeof(line), fp) != nullptr
+        && !strncmp(line, TUNING_CACHE_LAYOUT, strlen(TUNING_CACHE_LAYOUT));
+    fclose(fp);
+  }
+
+  fp = fopen(path.c_str(), layout_ok ? "a" : "w");
+  if (fp == nullptr) {
+    el_log(__WARN, "tuning-cache: %s: open failed", path.c_str());
+    return;
+  }
+  if (!layout_ok)
+    fprintf(fp, "%s\n", TUNING_CACHE_LAYOUT);
+  fprintf(fp, "%s %d %x %d %d %d %d %d %d %d %d %d %d %d\n", key.c_str(),
+          e.algorithm, e.execution_mode, e.flatting_o, e.flatting_t,
+          e.blocking_i, e.blocking_o, e.partition_i, e.partition_o,
+          e.partition_g, e.tile_size, e.f16c_opt, e.streaming_input,
+          e.streaming_output);
+  fclose(fp);
+}
+
+}  // namespace euler
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+#include "euler.hpp"
+
+namespace euler {
+
+// Persistent tuning cache
+//
+// Tuned algorithm, execution_mode, flatting, blocking, partition,
+// tile_size, f16c_opt and streaming_hint are kept in
+// $EULER_TUNING_CACHE_DIR/euler_tuning_cache.txt, one "<key> <values>"
+// entry per line, last entry wins. The key covers dims, pads, strides,
+// dilations, formats, data types, fusion flags, user requested algorithm,
+// f16c_opt, execution_mode, tile_size and wino_error_budget, ISA, nthreads
+// and EULER_VERSION. Files with another layout version are ignored.
+bool tuning_cache_enabled();
+
+// Build the cache key of a descriptor. Call before setup() resolves
+// algorithm/tile_size/f16c_opt.
+std::string tuning_cache_key(const eld_conv_t &desc);
+
+// Apply cached parameters to desc, return false on miss
+bool tuning_cache_load(const std::string &key, eld_conv_t &desc);
+
+// Append tuned parameters of desc, under file lock
+void tuning_cache_store(const std::string &key, const eld_conv_t &desc);
+
+}  // namespace euler
@@ -1,4 +1,7 @@
+#include <typeinfo>
 #include "el_parallel.hpp"
+#include "elx_conv_cost.hpp"
+#include "elx_post_ops.hpp"
 #include "elx_conv_wino.hpp"
 #include "elx_conv_wino_bind.hpp"
 #include "elx_conv_wino_xopt.hpp"
@@ -40,6 +43,7 @@ Template_elx_conv_wino_t Instance_elx_conv_wino_t::elx_conv_wino_t(
   is_first_run_ = true;
   inference_acc_ = false;
   inference_acc_ = ep.prop_kind == forward_inference;
+  replicate_workspace_ = ep.numa;
 
   ep.O4 = ep.O4 == 0 ? 1 : ep.O4;
   ep.I4 = ep.I4 == 0 ? 1 : ep.I4;
@@ -50,6 +54,8 @@ Template_elx_conv_wino_t Instance_elx_conv_wino_t::elx_conv_wino_t(
 
   ep.t2 = (ep.t + ep.T - 1) / ep.T;
 
+  if (xopt_ == 0)
+    xopt_ = conv_xopt_plan(dc, CONV_WINOGRAD, A);
   if (xopt_ == 0) {
     auto t2_th = ep.t2 / mthr_;
     xopt_ = t2_th > 1 ? 0xa061 : 0xa033;
@@ -57,16 +63,41 @@ Template_elx_conv_wino_t Instance_elx_conv_wino_t::elx_conv_wino_t(
 
   if ((xopt_ == 0xa073 || ep.with_ip_sum)
       && ep.with_relu && !output_is_bfmt_) {
-    el_error("Unimplemented: fuse sum (plain format) and relu together");
+    // Relu after the plain sum/output, by the post-op pass
+    if (ep.output_data_type != f32)
+      el_error("Unimplemented: fuse sum (plain format) and relu together");
+    post_ops_defer_relu(ep);
   }
 
   prepare_execute_opt();
   bind_execute_functions();
+  // Post-ops and the sum scale on the trans_output store. Plain nchw
+  // output sums, and accumulates I4, after the kernel
+  if (ep.output_data_type == f32) {
+    ep.post_ops_fused = !ep.post_ops.empty()
+        && !(ep.with_ip_sum && !output_is_bfmt_)
+        && (output_is_bfmt_ || output_as_bfmt_ || ep.output_fmt == nhwc
+            || ep.I4 == 1);
+    ep.sum_scale_fused = ep.with_ip_sum && ep.sum_scale != 1.f
+        && ep.I4 == 1 && !output_as_bfmt_;
+  }
   trans_input.setup(&ep);
   trans_weights.setup(&ep);
   gemm.setup(&ep);
   trans_output.setup(&ep);
 
+  // tweights_ depends on weights content and this layout only
+  weights_size_ = (weights_is_bfmt_ || weights_as_bfmt_
+      ? (size_t)ep.OC * ep.IC : (size_t)ep.oc * ep.ic)
+      * K * K * sizeof(WeightsType);
+  if (ep.tweights_cache) {
+    char key[512];
+    snprintf(key, sizeof(key), "%s:%x:%d:%d:%d:%d:%d:%d:%d:%d:%d:%d",
+             typeid(*this).name(), xopt_, ep.ic, ep.oc, ep.O2, ep.O3, ep.O4,
+             ep.I2, ep.I3, ep.I4, ep.weights_fmt, weights_as_bfmt_);
+    workspace_cache_key_ = key;
+  }
+
   if (V * ep.I2 * ep.I3 * ep.I4 != ep.IC) {
     el_error("V * I2 * I3 * I4 != ep.IC\n)");
   }
@@ -212,12 +243,20 @@ template class elx_conv_wino_t<conv::FP32, conv_impl::FP32, 4, 3, 16, ISA_AVX512
 template class elx_conv_wino_t<conv::FP32, conv_impl::FP32, 5, 3, 16, ISA_AVX512>;
 template class elx_conv_wino_t<conv::FP32, conv_impl::FP32, 6, 3, 16, ISA_AVX512>;
 template class elx_conv_wino_t<conv::FP32, conv_impl::FP32, 7, 3, 16, ISA_AVX512>;
+template class elx_conv_wino_t<conv::FP32, conv_impl::FP32, 8, 3, 16, ISA_AVX512>;
+template class elx_conv_wino_t<conv::FP32, conv_impl::FP32, 6, 5, 16, ISA_AVX512>;
+template class elx_conv_wino_t<conv::FP32, conv_impl::FP32, 8, 5, 16, ISA_AVX512>;
+template class elx_conv_wino_t<conv::FP32, conv_impl::FP32, 8, 7, 16, ISA_AVX512>;
 
 // fp32-f16f16f16
 template class elx_conv_wino_t<conv::FP32, conv_impl::FP32_F16iwo, 4, 3, 16, ISA_AVX512>;
 template class elx_conv_wino_t<conv::FP32, conv_impl::FP32_F16iwo, 5, 3, 16, ISA_AVX512>;
 template class elx_conv_wino_t<conv::FP32, conv_impl::FP32_F16iwo, 6, 3, 16, ISA_AVX512>;
 template class elx_conv_wino_t<conv::FP32, conv_impl::FP32_F16iwo, 7, 3, 16, ISA_AVX512>;
+template class elx_conv_wino_t<conv::FP32, conv_impl::FP32_F16iwo, 8, 3, 16, ISA_AVX512>;
+template class elx_conv_wino_t<conv::FP32, conv_impl::FP32_F16iwo, 6, 5, 16, ISA_AVX512>;
+template class elx_conv_wino_t<conv::FP32, conv_impl::FP32_F16iwo, 8, 5, 16, ISA_AVX512>;
+template class elx_conv_wino_t<conv::FP32, conv_impl::FP32_F16iwo, 8, 7, 16, ISA_AVX512>;
 
 #ifdef ENABLE_USER_FP16
 // fp16-f32f16f16
@@ -225,6 +264,10 @@ template class elx_conv_wino_t<conv::FP16, conv_impl::FP32_F16wob, 4, 3, 16, ISA
 template class elx_conv_wino_t<conv::FP16, conv_impl::FP32_F16wob, 5, 3, 16, ISA_AVX512>;
 template class elx_conv_wino_t<conv::FP16, conv_impl::FP32_F16wob, 6, 3, 16, ISA_AVX512>;
 template class elx_conv_wino_t<conv::FP16, conv_impl::FP32_F16wob, 7, 3, 16, ISA_AVX512>;
+template class elx_conv_wino_t<conv::FP16, conv_impl::FP32_F16wob, 8, 3, 16, ISA_AVX512>;
+template class elx_conv_wino_t<conv::FP16, conv_impl::FP32_F16wob, 6, 5, 16, ISA_AVX512>;
+template class elx_conv_wino_t<conv::FP16, conv_impl::FP32_F16wob, 8, 5, 16, ISA_AVX512>;
+template class elx_conv_wino_t<conv::FP16, conv_impl::FP32_F16wob, 8, 7, 16, ISA_AVX512>;
 #endif
 
 } // namespace euler
@@ -110,6 +110,8 @@ private:
   size_t binput_size_;
   size_t bweights_size_;
   size_t boutput_size_;
+  // Bytes of weights read by trans_weights
+  size_t weights_size_;
 
   TweightsType *tweights_;
   TinputType *tinput_;
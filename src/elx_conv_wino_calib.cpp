@@ -0,0 +1,235 @@
+#include <string.h>
+#include <float.h>
+#include <math.h>
+#include <random>
+#include <vector>
+#include "el_def.hpp"
+#include "el_utils.hpp"
+#include "el_stl.hpp"
+#include "el_parallel.hpp"
+#include "elx_conv.hpp"
+#include "elx_conv_cost.hpp"
+#include "elx_conv_wino_calib.hpp"
+
+namespace euler {
+
+struct wino_calib_point_t {
+  int A;
+  bool f16c_opt;
+  float error, cost;
+};
+
+class elx_conv_wino_calib_t {
+public:
+  elx_conv_wino_calib_t(eld_conv_t &dc);
+  ~elx_conv_wino_calib_t();
+
+  int calibrate();
+
+private:
+  void reference();
+  float measure(int A, bool f16c_opt);
+  float cost(int A, bool f16c_opt);
+
+  eld_conv_t &dc_;
+  // One image, nchw/oihw/nchw
+  size_t in_size_, wei_size_, out_size_;
+  float *input_, *weights_, *ref_;
+  float ref_max_;
+};
+
+elx_conv_wino_calib_t::elx_conv_wino_calib_t(eld_conv_t &dc) : dc_(dc)
+{
+  auto &d = dc.dims;
+  in_size_ = (size_t)d.ic * d.ih * d.iw;
+  wei_size_ = (size_t)d.oc * d.ic * d.kh * d.kw;
+  out_size_ = (size_t)d.oc * d.oh * d.ow;
+
+  memalign64(&input_, in_size_ * sizeof(float));
+  memalign64(&weights_, wei_size_ * sizeof(float));
+  memalign64(&ref_, out_size_ * sizeof(float));
+
+  if (dc.wino_calib_data.input != nullptr) {
+    memcpy(input_, dc.wino_calib_data.input, in_size_ * sizeof(float));
+  } else {
+    std::default_random_engine gen;
+    std::normal_distribution<float> dist(0.0f, 1.0f);
+    for (size_t i = 0; i < in_size_; ++i)
+      input_[i] = dist(gen);
+  }
+  if (dc.wino_calib_data.weights != nullptr) {
+    memcpy(weights_, dc.wino_calib_data.weights, wei_size_ * sizeof(float));
+  } else {
+    std::default_random_engine gen(1);
+    std::normal_distribution<float> dist(0.0f, 1.0f);
+    for (size_t i = 0; i < wei_size_; ++i)
+      weights_[i] = dist(gen);
+  }
+}
+
+elx_conv_wino_calib_t::~elx_conv_wino_calib_t()
+{
+  ::free(input_);
+  ::free(weights_);
+  ::free(ref_);
+}
+
+// Direct convolution in double, stride 1
+void elx_conv_wino_calib_t::reference()
+{
+  auto &d = dc_.dims;
+  const int tp = dc_.pads.t, lp = dc_.pads.l;
+  MD3(float, ainput, input_, d.ic, d.ih, d.iw);
+  MD4(float, aweights, weights_, d.oc, d.ic, d.kh, d.kw);
+  MD3(float, aref, ref_, d.oc, d.oh, d.ow);
+
+  estl::parallel_for<2>([&](int _oc, int _oh) {
+    iter_each (_ow, d.ow) {
+      double acc = 0.0;
+      iter_each (_ic, d.ic) {
+        iter_each (_kh, d.kh) {
+          int _ih = _oh - tp + _kh;
+          if (_ih < 0 || _ih >= d.ih) continue;
+          iter_each (_kw, d.kw) {
+            int _iw = _ow - lp + _kw;
+            if (_iw < 0 || _iw >= d.iw) continue;
+            acc += (double)md3(ainput, _ic, _ih, _iw)
+                * md4(aweights, _oc, _ic, _kh, _kw);
+          }
+        }
+      }
+      md3(aref, _oc, _oh, _ow) = (float)acc;
+    }
+  }, d.oc, d.oh);
+
+  ref_max_ = 0.0f;
+  for (size_t i = 0; i < out_size_; ++i)
+    ref_max_ = estl::max(ref_max_, fabsf(ref_[i]));
+}
+
+// Max error relative to the largest reference output, FLT_MAX if the
+// candidate cannot be set up
+float elx_conv_wino_calib_t::measure(int A, bool f16c_opt)
+{
+  eld_conv_t c;
+  conv_desc_clone(c, dc_);
+  c.dims.n = 1;
+  c.formats = { nchw, oihw, nchw };
+  c.algorithm = CONV_WINOGRAD;
+  c.tile_size = A;
+  c.f16c_opt = f16c_opt;
+  c.disable_autoparam = true;
+  c.auto_tune = false;
+  c.with_bias = c.with_relu = c.with_ip_sum = false;
+  c.with_batch_norm = false;
+  c.post_ops.clear();
+  c.flatting = { 0, 0 };
+  c.blocking = { 0, 0 };
+  c.partition = { 1, 1, 1 };
+  c.eager_mode = true;
+  c.name = dc_.name + "-calib";
+  if (c.setup() != ELD_OK || c.xc == nullptr)
+    return FLT_MAX;
+
+  float *input, *weights, *output;
+  memalign64(&input, c.byte_sizes.input);
+  memalign64(&weights, c.byte_sizes.weights);
+  memalign64(&output, c.byte_sizes.output);
+  memcpy(input, input_, in_size_ * sizeof(float));
+  memcpy(weights, weights_, wei_size_ * sizeof(float));
+
+  float error = FLT_MAX;
+  if (elx_conv(c, output, input, weights, nullptr) == ELX_OK) {
+    float max_delta = 0.0f;
+    for (size_t i = 0; i < out_size_; ++i)
+      max_delta = estl::max(max_delta, fabsf(output[i] - ref_[i]));
+    error = ref_max_ > 0.0f ? max_delta / ref_max_ : max_delta;
+  }
+
+  ::free(input);
+  ::free(weights);
+  ::free(output);
+  return error;
+}
+
+// Cost model estimate of the full layer at its planned xopt
+float elx_conv_wino_calib_t::cost(int A, bool f16c_opt)
+{
+  bool saved_f16c_opt = dc_.f16c_opt;
+  bool saved_disable_autoparam = dc_.disable_autoparam;
+  dc_.f16c_opt = f16c_opt;
+  dc_.disable_autoparam = true;
+
+  float c = FLT_MAX;
+  int xopt = dc_.execution_mode != 0
+      ? dc_.execution_mode : conv_xopt_plan(dc_, CONV_WINOGRAD, A);
+  if (xopt != 0)
+    c = conv_cost(conv_cost_shape(dc_), CONV_WINOGRAD, xopt, A);
+
+  dc_.f16c_opt = saved_f16c_opt;
+  dc_.disable_autoparam = saved_disable_autoparam;
+  return c;
+}
+
+int elx_conv_wino_calib_t::calibrate()
+{
+  reference();
+
+  // f16 transformed buffers are a candidate unless pinned off by user
+  std::vector<bool> f16_opts = { false };
+  if (dc_.f16c_opt)
+    f16_opts.push_back(true);
+
+  std::vector<wino_calib_point_t> points;
+  for (int A = 4; A <= 8; ++A) {
+    if (!elx_conv_wino_supported(A, dc_.dims.kh))
+      continue;
+    for (bool f16 : f16_opts) {
+      // No f16 at tile size 8, see eld_conv_t::setup()
+      if (f16 && A == 8)
+        continue;
+      wino_calib_point_t p = { A, f16, measure(A, f16), cost(A, f16) };
+      if (p.error == FLT_MAX)
+        continue;
+      el_log(__DEBUG, "wino-calib: %s: A=%d, f16c_opt=%d: error=%g, "
+             "%.0f cycles", dc_.name.c_str(), p.A, p.f16c_opt, p.error,
+             p.cost);
+      points.push_back(p);
+    }
+  }
+  if (points.empty()) {
+    el_log(__INFO, "wino-calib: %s: no candidate", dc_.name.c_str());
+    return ELD_UNIMPLEMENTED;
+  }
+
+  const wino_calib_point_t *best = nullptr, *accurate = &points[0];
+  for (auto &p : points) {
+    if (p.error < accurate->error)
+      accurate = &p;
+    if (p.error <= dc_.wino_error_budget
+        && (best == nullptr || p.cost < best->cost))
+      best = &p;
+  }
+  if (best == nullptr) {
+    el_warn("Winograd error budget not met, most accurate tile size used");
+    best = accurate;
+  }
+
+  dc_.tile_size = best->A;
+  dc_.f16c_opt = best->f16c_opt;
+  el_log(__INFO, "wino-calib: %s: A=%d, f16c_opt=%d, error=%g, budget=%g",
+         dc_.name.c_str(), best->A, best->f16c_opt, best->error,
+         dc_.wino_error_budget);
+  return ELD_OK;
+}
+
+int elx_conv_wino_calibrate(eld_conv_t &desc)
+{
+  if (desc.dims.g != 1 || desc.strides.h != 1 || desc.strides.w != 1
+      || desc.dilations.h != 1 || desc.dilations.w != 1)
+    return ELD_UNIMPLEMENTED;
+  elx_conv_wino_calib_t calib(desc);
+  return calib.calibrate();
+}
+
+}  // namespace euler
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "euler.hpp"
+
+namespace euler {
+
+// Winograd error calibration
+//
+// Run each supported tile size A of the kernel size, with fp32 and f16
+// transformed buffers (f16c_opt), on one sample image against a direct
+// fp32 reference. Error is max |y - ref| / max |ref| over the output.
+// Write the lowest cost (A, f16c_opt) within desc.wino_error_budget back
+// to desc.tile_size/f16c_opt, else the most accurate one. Sample data
+// is desc.wino_calib_data, or random if null.
+//
+// Supported: fp32 stride-1 CONV_WINOGRAD, g = 1
+int elx_conv_wino_calibrate(eld_conv_t &desc);
+
+}  // namespace euler
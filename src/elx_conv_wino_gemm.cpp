@@ -232,12 +232,14 @@ template class elx_conv_wino_gemm_t<conv_impl::FP32, 4, 16, ISA_AVX512>;
 template class elx_conv_wino_gemm_t<conv_impl::FP32, 5, 16, ISA_AVX512>;
 template class elx_conv_wino_gemm_t<conv_impl::FP32, 6, 16, ISA_AVX512>;
 template class elx_conv_wino_gemm_t<conv_impl::FP32, 7, 16, ISA_AVX512>;
+template class elx_conv_wino_gemm_t<conv_impl::FP32, 8, 16, ISA_AVX512>;
 
 // f16f16f16f32
 template class elx_conv_wino_gemm_t<conv_impl::FP32_F16iwo, 4, 16, ISA_AVX512>;
 template class elx_conv_wino_gemm_t<conv_impl::FP32_F16iwo, 5, 16, ISA_AVX512>;
 template class elx_conv_wino_gemm_t<conv_impl::FP32_F16iwo, 6, 16, ISA_AVX512>;
 template class elx_conv_wino_gemm_t<conv_impl::FP32_F16iwo, 7, 16, ISA_AVX512>;
+template class elx_conv_wino_gemm_t<conv_impl::FP32_F16iwo, 8, 16, ISA_AVX512>;
 
 #ifdef ENABLE_USER_FP16
 // f32f16f16f16
@@ -245,6 +247,7 @@ template class elx_conv_wino_gemm_t<conv_impl::FP32_F16wob, 4, 16, ISA_AVX512>;
 template class elx_conv_wino_gemm_t<conv_impl::FP32_F16wob, 5, 16, ISA_AVX512>;
 template class elx_conv_wino_gemm_t<conv_impl::FP32_F16wob, 6, 16, ISA_AVX512>;
 template class elx_conv_wino_gemm_t<conv_impl::FP32_F16wob, 7, 16, ISA_AVX512>;
+template class elx_conv_wino_gemm_t<conv_impl::FP32_F16wob, 8, 16, ISA_AVX512>;
 #endif
 
 } // namespace euler
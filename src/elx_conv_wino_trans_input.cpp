@@ -17,10 +17,10 @@ namespace euler {
     __n = _t / ep->nt;                                                     \
     __ih = _ht * (A - K + 1) - ep->tp;                                     \
     __iw = _wt * (A - K + 1) - ep->lp;                                     \
-    __hA_start = (_ht > 0) ? 0 : ep->tp;                                   \
-    __wA_start = (_wt > 0) ? 0 : ep->lp;                                   \
-    __hA_end = (_ht < ep->ht - 1) ? A - 1 : hA_end_;                       \
-    __wA_end = (_wt < ep->wt - 1) ? A - 1 : wA_end_;                       \
+    __hA_start = __ih < 0 ? -__ih : 0;                                     \
+    __wA_start = __iw < 0 ? -__iw : 0;                                     \
+    __hA_end = estl::min(A - 1, ep->ih - 1 - __ih);                        \
+    __wA_end = estl::min(A - 1, ep->iw - 1 - __iw);                        \
   } while (0)
 
 template <typename TinputType, typename InputType, int I, int A, int K, int V>
@@ -900,11 +900,19 @@ template class elx_conv_wino_trans_input_t<float, float, ISA_AVX512, 4, 3, 16>;
 template class elx_conv_wino_trans_input_t<float, float, ISA_AVX512, 5, 3, 16>;
 template class elx_conv_wino_trans_input_t<float, float, ISA_AVX512, 6, 3, 16>;
 template class elx_conv_wino_trans_input_t<float, float, ISA_AVX512, 7, 3, 16>;
+template class elx_conv_wino_trans_input_t<float, float, ISA_AVX512, 8, 3, 16>;
+template class elx_conv_wino_trans_input_t<float, float, ISA_AVX512, 6, 5, 16>;
+template class elx_conv_wino_trans_input_t<float, float, ISA_AVX512, 8, 5, 16>;
+template class elx_conv_wino_trans_input_t<float, float, ISA_AVX512, 8, 7, 16>;
 
 template class elx_conv_wino_trans_input_t<float16, float, ISA_AVX512, 4, 3, 16>;
 template class elx_conv_wino_trans_input_t<float16, float, ISA_AVX512, 5, 3, 16>;
 template class elx_conv_wino_trans_input_t<float16, float, ISA_AVX512, 6, 3, 16>;
 template class elx_conv_wino_trans_input_t<float16, float, ISA_AVX512, 7, 3, 16>;
+template class elx_conv_wino_trans_input_t<float16, float, ISA_AVX512, 8, 3, 16>;
+template class elx_conv_wino_trans_input_t<float16, float, ISA_AVX512, 6, 5, 16>;
+template class elx_conv_wino_trans_input_t<float16, float, ISA_AVX512, 8, 5, 16>;
+template class elx_conv_wino_trans_input_t<float16, float, ISA_AVX512, 8, 7, 16>;
 
 template class elx_conv_wino_trans_input_t<uint8_t, float, ISA_AVX512, 4, 3, 16>;
 template class elx_conv_wino_trans_input_t<uint8_t, float, ISA_AVX512, 5, 3, 16>;
@@ -920,6 +928,10 @@ template class elx_conv_wino_trans_input_t<float, float16, ISA_AVX512, 4, 3, 16>
 template class elx_conv_wino_trans_input_t<float, float16, ISA_AVX512, 5, 3, 16>;
 template class elx_conv_wino_trans_input_t<float, float16, ISA_AVX512, 6, 3, 16>;
 template class elx_conv_wino_trans_input_t<float, float16, ISA_AVX512, 7, 3, 16>;
+template class elx_conv_wino_trans_input_t<float, float16, ISA_AVX512, 8, 3, 16>;
+template class elx_conv_wino_trans_input_t<float, float16, ISA_AVX512, 6, 5, 16>;
+template class elx_conv_wino_trans_input_t<float, float16, ISA_AVX512, 8, 5, 16>;
+template class elx_conv_wino_trans_input_t<float, float16, ISA_AVX512, 8, 7, 16>;
 
 template class elx_conv_wino_trans_input_t<uint8_t, float16, ISA_AVX512, 4, 3, 16>;
 template class elx_conv_wino_trans_input_t<uint8_t, float16, ISA_AVX512, 5, 3, 16>;
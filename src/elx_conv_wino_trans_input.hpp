@@ -3,6 +3,7 @@
 #include "euler.hpp"
 #include "el_def.hpp"
 #include "el_utils.hpp"
+#include "el_stl.hpp"
 #include "elx_conv.hpp"
 #include "kernel/elk_conv_wino.hpp"
 
@@ -10,6 +11,7 @@
 #include "kernel/elk_conv_wino_3x3_3x3_input.hxx"
 #include "kernel/elk_conv_wino_4x4_3x3_input.hxx"
 #include "kernel/elk_conv_wino_5x5_3x3_input.hxx"
+#include "kernel/elk_conv_wino_generic_input.hxx"
 
 namespace euler {
 
@@ -203,25 +205,36 @@ protected:
   using super::ker_trans_input0_;
 };
 
-// Three stage indexing, width, hight, image
+// Three stage indexing, width, hight, image. Tile bounds follow the
+// anchor: with padding wider than the output line (F(2,7)) more than the
+// first/last tiles reach into it.
 template <int A, int K>
 class input_tile_iter {
   constexpr static int output_line = A - K +1;
 public:
   input_tile_iter(int n_init, int t_init,
       int ht, int wt, int h, int w, int tp, int lp)
-    : ht_(ht), wt_(wt), tp_(tp), lp_(lp),
+    : ht_(ht), wt_(wt), h_(h), w_(w), tp_(tp), lp_(lp),
     hA_end_(h + tp - (ht -1) * output_line -1),
     wA_end_(w + lp - (wt -1) * output_line -1),
     tile_h_(t_init / wt),
     tile_w_(t_init % wt),
     anchor_t_(tile_h_ * output_line - tp),
     anchor_l_(tile_w_ * output_line - lp),
-    n_(n_init),
-    t_ (tile_h_ > 0 ? 0 : tp),
-    l_ (tile_w_ > 0 ? 0 : lp),
-    d_ (tile_h_ < ht -1 ? A -1 : hA_end_),
-    r_ (tile_w_ < wt -1 ? A -1 : wA_end_) {}
+    n_(n_init) {
+    bound_h();
+    bound_w();
+  }
+
+  inline void bound_h() {
+    t_ = anchor_t_ < 0 ? -anchor_t_ : 0;
+    d_ = estl::min(A - 1, h_ - 1 - anchor_t_);
+  }
+
+  inline void bound_w() {
+    l_ = anchor_l_ < 0 ? -anchor_l_ : 0;
+    r_ = estl::min(A - 1, w_ - 1 - anchor_l_);
+  }
 
   inline input_tile_iter &operator ++() {
     if ( ++ tile_w_ < wt_) {
@@ -236,12 +249,10 @@ public:
         tile_h_ = 0;
         anchor_t_ = -tp_;
       }
-      t_ = tile_h_ > 0 ? 0 : tp_;
-      d_ = tile_h_ < ht_ - 1 ? A -1 : hA_end_;
+      bound_h();
     }
 
-    l_ = tile_w_ > 0 ? 0 : lp_;
-    r_ = tile_w_ < wt_ - 1 ? A -1 : wA_end_;
+    bound_w();
     return *this;
   }
 
@@ -250,7 +261,7 @@ public:
   }
 
 protected:
-  int ht_, wt_, tp_, lp_;
+  int ht_, wt_, h_, w_, tp_, lp_;
 
 public:
   int hA_end_, wA_end_;
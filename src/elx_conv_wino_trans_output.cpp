@@ -125,6 +125,9 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
     ToutputType *__restrict toutput, BiasType *__restrict bias, int Tz, int _t2,
     int _O4, int _I4)
 {
+  int attr = kernel_attr(_I4);
+  // Sum after the kernel, with its scale if fused
+  float sum_scale = ep->sum_scale_fused ? ep->sum_scale : 1.f;
   // A, A, O3, O2, T, V -> n, OC, oh, ow
   MD6(ToutputType, atoutput, toutput, A, A, ep->O3, ep->O2, Tz, V);
   MD3(BiasType, abias, bias, ep->O3, ep->O2, V);
@@ -144,9 +147,11 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
       for (int _wA = 0; _wA <= _wOA_end; ++_wA) {
         if (is_Or) {
           if ((ep->with_ip_sum && !output_as_bfmt_) || _I4 > 0) {
-            iter_each (_V, ep->Or)
-              md6(aoutput1, _O4, _O3, _O2, _V, _oh + _hA, _ow + _wA)
-                  += aout[_hA][_wA][_V];
+            iter_each (_V, ep->Or) {
+              auto &o = md6(aoutput1, _O4, _O3, _O2, _V, _oh + _hA,
+                            _ow + _wA);
+              o = (OutputType)(o * sum_scale) + aout[_hA][_wA][_V];
+            }
           } else {
             iter_each (_V, ep->Or)
               md6(aoutput1, _O4, _O3, _O2, _V, _oh + _hA, _ow + _wA)
@@ -155,9 +160,11 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
         } else {
           if ((ep->with_ip_sum && !output_as_bfmt_) || _I4 > 0) {
 #pragma omp simd
-            iter_each (_V, V)
-              md6(aoutput1, _O4, _O3, _O2, _V, _oh + _hA, _ow + _wA)
-                  += aout[_hA][_wA][_V];
+            iter_each (_V, V) {
+              auto &o = md6(aoutput1, _O4, _O3, _O2, _V, _oh + _hA,
+                            _ow + _wA);
+              o = (OutputType)(o * sum_scale) + aout[_hA][_wA][_V];
+            }
           } else if (I == ISA_AVX512
               && std::is_same<OutputType, float>::value) {
             __m<V> t = _mm<V>::load_ps(aout[_hA][_wA]);
@@ -201,7 +208,8 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
         ker_trans_output_(*ep, (OutputType *)aout, (float *)&In,
             (_I4 == ep->I4 - 1 || _I4 == -1) ? &md3(abias, _O3, _O2, 0)
                                                   : nullptr,
-            0, -1);
+            0, -1,
+            attr, kernel_oc(_O4, _O3, _O2));
 
         writeout(aout, _O3, _O2, _T, is_Or);
       }
@@ -215,6 +223,7 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
     V>::__execute_blocked(OutputType *output, ToutputType *toutput,
     BiasType *bias, int Tz, int _t2, int _O4, int _I4)
 {
+  int attr = kernel_attr(_I4);
   auto ker_trans_output = (ep->with_ip_sum || _I4 > 0)
       ? ker_trans_output_acc_
       : ker_trans_output_;
@@ -263,12 +272,14 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
           ker_trans_output_tail(*ep, out, (float *)&In,
               (_I4 == -1 || _I4 == ep->I4 - 1) ? &md3(abias, _O3, _O2, 0)
                                                     : nullptr,
-              t2spato_o.d_, t2spato_o.r_);
+              t2spato_o.d_, t2spato_o.r_,
+              attr, kernel_oc(_O4, _O3, _O2));
         else
           ker_trans_output(*ep, out, (float *)&In,
               (_I4 == -1 || _I4 == ep->I4 - 1) ? &md3(abias, _O3, _O2, 0)
                                                     : nullptr,
-              A - K, A - K);
+              A - K, A - K,
+              attr, kernel_oc(_O4, _O3, _O2));
 
         ++t2spato_o;
       }
@@ -282,6 +293,7 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
     V>::__execute_nhwc(OutputType *output, ToutputType *toutput, BiasType *bias,
     int Tz, int _t2, int _O4, int _I4)
 {
+  int attr = kernel_attr(_I4);
   auto ker_trans_output = (ep->with_ip_sum || _I4 > 0)
       ? ker_trans_output_acc_
       : ker_trans_output_;
@@ -329,12 +341,14 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
           ker_trans_output_tail(*ep, out, (float *)&In,
               (_I4 == -1 || _I4 == ep->I4 - 1) ? &md3(abias, _O3, _O2, 0)
                                                     : nullptr,
-              t2spato_o.d_, t2spato_o.r_);
+              t2spato_o.d_, t2spato_o.r_,
+              attr, kernel_oc(_O4, _O3, _O2));
         else
           ker_trans_output(*ep, out, (float *)&In,
               (_I4 == -1 || _I4 == ep->I4 - 1) ? &md3(abias, _O3, _O2, 0)
                                                     : nullptr,
-              A - K, A - K);
+              A - K, A - K,
+              attr, kernel_oc(_O4, _O3, _O2));
 
         ++t2spato_o;
       }
@@ -362,6 +376,7 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
     V>::__execute_blocked(OutputType *output, ToutputType *toutput,
     BiasType *bias, int _O4, int _I4)
 {
+  int attr = kernel_attr(_I4);
   auto ker_trans_output = (ep->with_ip_sum || _I4 > 0)
       ? ker_trans_output_acc_
       : ker_trans_output_;
@@ -411,13 +426,15 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
                 (_I4 == -1 || _I4 == ep->I4 - 1)
                     ? &md3(abias, _O3, _O2, 0)
                     : nullptr,
-                _hOA_end, _wOA_end);
+                _hOA_end, _wOA_end,
+                attr, kernel_oc(_O4, _O3, _O2));
           else
             ker_trans_output(*ep, out, (float *)&In,
                 (_I4 == -1 || _I4 == ep->I4 - 1)
                     ? &md3(abias, _O3, _O2, 0)
                     : nullptr,
-                A - K, A - K);
+                A - K, A - K,
+                attr, kernel_oc(_O4, _O3, _O2));
         }
       }, ep->t2, ep->O3, ep->O2, ep->T);
 }
@@ -428,6 +445,7 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
     V>::__execute_nhwc(OutputType *output, ToutputType *toutput, BiasType *bias,
     int _O4, int _I4)
 {
+  int attr = kernel_attr(_I4);
   auto ker_trans_output = (ep->with_ip_sum || _I4 > 0)
       ? ker_trans_output_acc_
       : ker_trans_output_;
@@ -475,13 +493,15 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
                 (_I4 == -1 || _I4 == ep->I4 - 1)
                     ? &md3(abias, _O3, _O2, 0)
                     : nullptr,
-                _hOA_end, _wOA_end);
+                _hOA_end, _wOA_end,
+                attr, kernel_oc(_O4, _O3, _O2));
           else
             ker_trans_output(*ep, out, (float *)&In,
                 (_I4 == -1 || _I4 == ep->I4 - 1)
                     ? &md3(abias, _O3, _O2, 0)
                     : nullptr,
-                A - K, A - K);
+                A - K, A - K,
+                attr, kernel_oc(_O4, _O3, _O2));
         }
       }, ep->t2, ep->O3, ep->O2);
 }
@@ -491,6 +511,9 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
     V>::__execute_nchw(OutputType *__restrict output,
     ToutputType *__restrict toutput, BiasType *bias, int _O4, int _I4)
 {
+  int attr = kernel_attr(_I4);
+  // Sum after the kernel, with its scale if fused
+  float sum_scale = ep->sum_scale_fused ? ep->sum_scale : 1.f;
   // A, A, O3, O2, T, V -> n, OC, oh, ow
   const __i<V> vindex = _mm<V>::set_epi32(SET_VINDEX_16(ep->oh * ep->ow));
 
@@ -507,9 +530,11 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
         if (is_Or) {
           if ((ep->with_ip_sum && !output_as_bfmt_) || (_I4 > 0)) {
 #pragma omp simd
-            iter_each (_V, ep->Or)
-              md6(aoutput1, _O4, _O3, _O2, _V, _oh + _hA, _ow + _wA)
-                  += aout[_hA][_wA][_V];
+            iter_each (_V, ep->Or) {
+              auto &o = md6(aoutput1, _O4, _O3, _O2, _V, _oh + _hA,
+                            _ow + _wA);
+              o = (OutputType)(o * sum_scale) + aout[_hA][_wA][_V];
+            }
           } else {
 #pragma omp simd
             iter_each (_V, ep->Or)
@@ -519,9 +544,11 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
         } else {
           if ((ep->with_ip_sum && !output_as_bfmt_) || (_I4 > 0)) {
 #pragma omp simd
-            iter_each (_V, V)
-              md6(aoutput1, _O4, _O3, _O2, _V, _oh + _hA, _ow + _wA)
-                  += aout[_hA][_wA][_V];
+            iter_each (_V, V) {
+              auto &o = md6(aoutput1, _O4, _O3, _O2, _V, _oh + _hA,
+                            _ow + _wA);
+              o = (OutputType)(o * sum_scale) + aout[_hA][_wA][_V];
+            }
           } else if (I == ISA_AVX512
               && std::is_same<OutputType, float>::value) {
             __m<V> t = _mm<V>::load_ps(aout[_hA][_wA]);
@@ -573,7 +600,8 @@ void elx_conv_wino_trans_output_t<OutputType, BiasType, ToutputType, I, A, K,
           ker_trans_output_(*ep, (OutputType *)aout, (float *)&In,
               (_I4 == -1 || _I4 == ep->I4 - 1) ? &md3(abias, _O3, _O2, 0)
                                                   : nullptr,
-              0, -1);
+              0, -1,
+              attr, kernel_oc(_O4, _O3, _O2));
           writeout(aout, _t2, _O3, _O2, _T, is_Or);
         }
       }, ep->t2, ep->O3, ep->O2);
@@ -599,12 +627,20 @@ template class elx_conv_wino_trans_output_t<float, float, float, ISA_AVX512, 4,
 template class elx_conv_wino_trans_output_t<float, float, float, ISA_AVX512, 5, 3, 16>;
 template class elx_conv_wino_trans_output_t<float, float, float, ISA_AVX512, 6, 3, 16>;
 template class elx_conv_wino_trans_output_t<float, float, float, ISA_AVX512, 7, 3, 16>;
+template class elx_conv_wino_trans_output_t<float, float, float, ISA_AVX512, 8, 3, 16>;
+template class elx_conv_wino_trans_output_t<float, float, float, ISA_AVX512, 6, 5, 16>;
+template class elx_conv_wino_trans_output_t<float, float, float, ISA_AVX512, 8, 5, 16>;
+template class elx_conv_wino_trans_output_t<float, float, float, ISA_AVX512, 8, 7, 16>;
 
 // user: float, tarray: fp16
 template class elx_conv_wino_trans_output_t<float, float, float16, ISA_AVX512, 4, 3, 16>;
 template class elx_conv_wino_trans_output_t<float, float, float16, ISA_AVX512, 5, 3, 16>;
 template class elx_conv_wino_trans_output_t<float, float, float16, ISA_AVX512, 6, 3, 16>;
 template class elx_conv_wino_trans_output_t<float, float, float16, ISA_AVX512, 7, 3, 16>;
+template class elx_conv_wino_trans_output_t<float, float, float16, ISA_AVX512, 8, 3, 16>;
+template class elx_conv_wino_trans_output_t<float, float, float16, ISA_AVX512, 6, 5, 16>;
+template class elx_conv_wino_trans_output_t<float, float, float16, ISA_AVX512, 8, 5, 16>;
+template class elx_conv_wino_trans_output_t<float, float, float16, ISA_AVX512, 8, 7, 16>;
 
 template class elx_conv_wino_trans_output_t<uint8_t, float, float, ISA_AVX512, 4, 3, 16>;
 template class elx_conv_wino_trans_output_t<uint8_t, float, float, ISA_AVX512, 5, 3, 16>;
@@ -620,12 +656,20 @@ template class elx_conv_wino_trans_output_t<float16, float16, float, ISA_AVX512,
 template class elx_conv_wino_trans_output_t<float16, float16, float, ISA_AVX512, 5, 3, 16>;
 template class elx_conv_wino_trans_output_t<float16, float16, float, ISA_AVX512, 6, 3, 16>;
 template class elx_conv_wino_trans_output_t<float16, float16, float, ISA_AVX512, 7, 3, 16>;
+template class elx_conv_wino_trans_output_t<float16, float16, float, ISA_AVX512, 8, 3, 16>;
+template class elx_conv_wino_trans_output_t<float16, float16, float, ISA_AVX512, 6, 5, 16>;
+template class elx_conv_wino_trans_output_t<float16, float16, float, ISA_AVX512, 8, 5, 16>;
+template class elx_conv_wino_trans_output_t<float16, float16, float, ISA_AVX512, 8, 7, 16>;
 
 // user: fp16, tarray: fp16
 template class elx_conv_wino_trans_output_t<float16, float16, float16, ISA_AVX512, 4, 3, 16>;
 template class elx_conv_wino_trans_output_t<float16, float16, float16, ISA_AVX512, 5, 3, 16>;
 template class elx_conv_wino_trans_output_t<float16, float16, float16, ISA_AVX512, 6, 3, 16>;
 template class elx_conv_wino_trans_output_t<float16, float16, float16, ISA_AVX512, 7, 3, 16>;
+template class elx_conv_wino_trans_output_t<float16, float16, float16, ISA_AVX512, 8, 3, 16>;
+template class elx_conv_wino_trans_output_t<float16, float16, float16, ISA_AVX512, 6, 5, 16>;
+template class elx_conv_wino_trans_output_t<float16, float16, float16, ISA_AVX512, 8, 5, 16>;
+template class elx_conv_wino_trans_output_t<float16, float16, float16, ISA_AVX512, 8, 7, 16>;
 #endif
 
 } // namespace euler
@@ -10,6 +10,7 @@
 #include "kernel/elk_conv_wino_3x3_3x3_output.hxx"
 #include "kernel/elk_conv_wino_4x4_3x3_output.hxx"
 #include "kernel/elk_conv_wino_5x5_3x3_output.hxx"
+#include "kernel/elk_conv_wino_generic_output.hxx"
 
 namespace euler {
 
@@ -61,6 +62,16 @@ public:
 
   void bind_kernel_functions();
 
+  // Kernel attr of the output pass of _I4, post-ops on the last one
+  inline int kernel_attr(int _I4) {
+    return ep->post_ops_fused && (_I4 == -1 || _I4 == ep->I4 - 1)
+        ? set_bit(0, AT_POST_OPS_MASK) : 0;
+  }
+  // First output channel of the _O4, _O3, _O2 block
+  inline int kernel_oc(int _O4, int _O3, int _O2) {
+    return ((_O4 * ep->O3 + _O3) * ep->O2 + _O2) * V;
+  }
+
   decltype(elk_conv_wino_trans_output<TrOpType, OutputType, BiasType, 0,
       false, false, false, false, I, A, K, V>::execute) *ker_trans_output_;
   decltype(elk_conv_wino_trans_output<TrOpType, OutputType, BiasType, 0,
@@ -556,11 +556,19 @@ template class elx_conv_wino_trans_weights_t<float, float, ISA_AVX512, 4, 3, 16>
 template class elx_conv_wino_trans_weights_t<float, float, ISA_AVX512, 5, 3, 16>;
 template class elx_conv_wino_trans_weights_t<float, float, ISA_AVX512, 6, 3, 16>;
 template class elx_conv_wino_trans_weights_t<float, float, ISA_AVX512, 7, 3, 16>;
+template class elx_conv_wino_trans_weights_t<float, float, ISA_AVX512, 8, 3, 16>;
+template class elx_conv_wino_trans_weights_t<float, float, ISA_AVX512, 6, 5, 16>;
+template class elx_conv_wino_trans_weights_t<float, float, ISA_AVX512, 8, 5, 16>;
+template class elx_conv_wino_trans_weights_t<float, float, ISA_AVX512, 8, 7, 16>;
 
 template class elx_conv_wino_trans_weights_t<short, float, ISA_AVX512, 4, 3, 16>;
 template class elx_conv_wino_trans_weights_t<short, float, ISA_AVX512, 5, 3, 16>;
 template class elx_conv_wino_trans_weights_t<short, float, ISA_AVX512, 6, 3, 16>;
 template class elx_conv_wino_trans_weights_t<short, float, ISA_AVX512, 7, 3, 16>;
+template class elx_conv_wino_trans_weights_t<short, float, ISA_AVX512, 8, 3, 16>;
+template class elx_conv_wino_trans_weights_t<short, float, ISA_AVX512, 6, 5, 16>;
+template class elx_conv_wino_trans_weights_t<short, float, ISA_AVX512, 8, 5, 16>;
+template class elx_conv_wino_trans_weights_t<short, float, ISA_AVX512, 8, 7, 16>;
 
 template class elx_conv_wino_trans_weights_t<int8_t, float, ISA_AVX512, 4, 3, 16>;
 template class elx_conv_wino_trans_weights_t<int8_t, float, ISA_AVX512, 5, 3, 16>;
@@ -572,11 +580,19 @@ template class elx_conv_wino_trans_weights_t<float, short, ISA_AVX512, 4, 3, 16>
 template class elx_conv_wino_trans_weights_t<float, short, ISA_AVX512, 5, 3, 16>;
 template class elx_conv_wino_trans_weights_t<float, short, ISA_AVX512, 6, 3, 16>;
 template class elx_conv_wino_trans_weights_t<float, short, ISA_AVX512, 7, 3, 16>;
+template class elx_conv_wino_trans_weights_t<float, short, ISA_AVX512, 8, 3, 16>;
+template class elx_conv_wino_trans_weights_t<float, short, ISA_AVX512, 6, 5, 16>;
+template class elx_conv_wino_trans_weights_t<float, short, ISA_AVX512, 8, 5, 16>;
+template class elx_conv_wino_trans_weights_t<float, short, ISA_AVX512, 8, 7, 16>;
 
 template class elx_conv_wino_trans_weights_t<short, short, ISA_AVX512, 4, 3, 16>;
 template class elx_conv_wino_trans_weights_t<short, short, ISA_AVX512, 5, 3, 16>;
 template class elx_conv_wino_trans_weights_t<short, short, ISA_AVX512, 6, 3, 16>;
 template class elx_conv_wino_trans_weights_t<short, short, ISA_AVX512, 7, 3, 16>;
+template class elx_conv_wino_trans_weights_t<short, short, ISA_AVX512, 8, 3, 16>;
+template class elx_conv_wino_trans_weights_t<short, short, ISA_AVX512, 6, 5, 16>;
+template class elx_conv_wino_trans_weights_t<short, short, ISA_AVX512, 8, 5, 16>;
+template class elx_conv_wino_trans_weights_t<short, short, ISA_AVX512, 8, 7, 16>;
 
 template class elx_conv_wino_trans_weights_t<int8_t, short, ISA_AVX512, 4, 3, 16>;
 template class elx_conv_wino_trans_weights_t<int8_t, short, ISA_AVX512, 5, 3, 16>;
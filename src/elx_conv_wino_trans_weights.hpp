@@ -10,6 +10,7 @@
 #include "kernel/elk_conv_wino_3x3_3x3_weights.hxx"
 #include "kernel/elk_conv_wino_4x4_3x3_weights.hxx"
 #include "kernel/elk_conv_wino_5x5_3x3_weights.hxx"
+#include "kernel/elk_conv_wino_generic_weights.hxx"
 
 namespace euler {
 
@@ -34,16 +34,17 @@ void Instance_elx_conv_wino_t::__execute_a061(
   if (is_first_run_) {
     setup_workspace([&](){
       trans_weights(tweights_, weights, ep.O4);
-    });
+    }, weights, weights_size_);
   }
   auto t2_history = -1;
 
-  estl::parallel_for<2>([&, t2_history](int _t2, int _O4) mutable {
+  estl::parallel_for_dynamic<2>(mthr_, 1,
+      [&, t2_history](int _t2, int _O4) mutable {
     MD2(TinputType, atinput2, tinput_, mthr_,
         A * A * ep.T * ep.IC);
     MD2(ToutputType, atoutput2, toutput_, mthr_,
         A * A * ep.T * ep.O3 * ep.O2 * V);
-    MD2(TweightsType, atweights2, tweights_, ep.O4,
+    MD2(TweightsType, atweights2, numa_local(tweights_), ep.O4,
         A * A * ep.IC * ep.O3 * ep.O2 * V);
     MD2(BiasType, abias, bias, ep.O4, ep.O3 * ep.O2 * V);
 
@@ -78,7 +79,7 @@ void Instance_elx_conv_wino_t::__execute_a071(
   if (is_first_run_) {
     setup_workspace([&](){
       trans_weights(tweights_, weights, ep.O4);
-    });
+    }, weights, weights_size_);
   }
   int last_I4 = -1, last_t2 = -1;
 
@@ -88,7 +89,7 @@ void Instance_elx_conv_wino_t::__execute_a071(
         A * A * ep.T * ep.I3 * ep.I2 * V);
     MD2(ToutputType, atoutput2, toutput_, ep.t2,
         ep.O4 * A * A * ep.T * ep.O3 * ep.O2 * V);
-    MD3(TweightsType, atweights3, tweights_, ep.O4, ep.I4,
+    MD3(TweightsType, atweights3, numa_local(tweights_), ep.O4, ep.I4,
         A * A * ep.I3 * ep.I2 * V * ep.O3 * ep.O2 * V);
     MD2(BiasType, abias, bias, ep.O4, ep.O3 * ep.O2 * V);
 
@@ -126,7 +127,7 @@ void Instance_elx_conv_wino_t::__execute_a073(
   if (is_first_run_) {
     setup_workspace([&](){
       trans_weights(tweights_, weights, ep.O4);
-    });
+    }, weights, weights_size_);
   }
 
   int last_I4 = -1, last_t2 = -1;
@@ -137,7 +138,7 @@ void Instance_elx_conv_wino_t::__execute_a073(
         A * A * ep.T * ep.I3 * ep.I2 * V);
     MD2(ToutputType, atoutput2, toutput_, mthr_,
         A * A * ep.T * ep.O3 * ep.O2 * V);
-    MD3(TweightsType, atweights3, tweights_, ep.O4, ep.I4,
+    MD3(TweightsType, atweights3, numa_local(tweights_), ep.O4, ep.I4,
         A * A * ep.I3 * ep.I2 * V * ep.O3 * ep.O2 * V);
     MD2(BiasType, abias, bias, ep.O4, ep.O3 * ep.O2 * V);
 
@@ -171,17 +172,17 @@ void Instance_elx_conv_wino_t::__execute_a000(
   if (is_first_run_) {
     setup_workspace([&](){
       trans_weights(tweights_, weights);
-    });
+    }, weights, weights_size_);
   }
 
   THREAD_PARALLEL()
   {
     trans_input(tinput_, input, 0);
     THREAD_BARRIER();
-    gemm.execute(toutput_, tinput_, tweights_);
+    gemm.execute(toutput_, tinput_, numa_local(tweights_));
     THREAD_BARRIER();
     trans_output(output, toutput_, bias, 0, 0);
-  }
+  };
   if (is_first_run_ && inference_acc_) is_first_run_ = false;
 }
 
@@ -193,16 +194,17 @@ void Instance_elx_conv_wino_t::__execute_a033(
   if (is_first_run_) {
     setup_workspace([&](){
       trans_weights(tweights_, weights, ep.O4);
-    });
+    }, weights, weights_size_);
   }
 
-  TinputType *_tinput = ep.use_scratch_pad
-      ? (TinputType *)ep.scratch_pad : tinput_;
+  // tinput_ leads the scratch layout, so a caller scratch_pad also
+  // exposes transformed input
+  TinputType *_tinput = tinput_;
 
   THREAD_PARALLEL()
   {
     int last_I4 = -1;
-    MD3(TweightsType, atweights, tweights_, ep.O4, ep.I4,
+    MD3(TweightsType, atweights, numa_local(tweights_), ep.O4, ep.I4,
         A * A * ep.I3 * ep.I2 * V * ep.O3 * ep.O2 * V);
     MD2(BiasType, abias, bias, ep.O4, ep.O3 * ep.O2 * V);
 
@@ -218,7 +220,7 @@ void Instance_elx_conv_wino_t::__execute_a033(
       trans_output(
           output, toutput_, &md2(abias, _O4, 0), _O4, _I4);
     }}
-  }
+  };
 
   if (is_first_run_ && inference_acc_)
     is_first_run_ = false;
@@ -14,7 +14,7 @@ Instance_elx_deconv_direct_t::elx_deconv_direct_t(eld_conv_t &dc)
 {
   // user input
   xopt_ = ep.execution_mode;
-  mthr_ = estl::max_concurrency();
+  mthr_ = ep.nthreads;
 
   ep.Vx = 1;
   ep.V1 = V / ep.Vx;
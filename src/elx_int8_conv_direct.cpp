@@ -2,6 +2,8 @@
 #include "el_stl.hpp"
 #include "el_utils.hpp"
 #include "el_parallel.hpp"
+#include "elx_conv_cost.hpp"
+#include "elx_post_ops.hpp"
 #include "elx_int8_conv_direct.hpp"
 #include "elx_int8_conv_direct_bind.hpp"
 #include "elx_int8_conv_direct_xopt.hpp"
@@ -12,7 +14,14 @@ Template_elx_int8_conv_direct_t
 Instance_elx_int8_conv_direct_t::elx_int8_conv_direct_t(eld_conv_t &dc)
     : elx_conv_t(dc)
 {
-  xopt_ = 0; //ep.execution_mode;
+  xopt_ = ep.execution_mode;
+  if (xopt_ != 0 && !conv_xopt_supported(conv_cost_shape(dc), CONV_DIRECT,
+                                         xopt_)) {
+    el_warn("int8 direct: execution-mode not supported, ignored");
+    xopt_ = 0;
+  }
+  if (xopt_ == 0)
+    xopt_ = conv_xopt_plan(dc, CONV_DIRECT);
   if (xopt_ == 0) {
     if (estl::any_of(ep.kw, 3, 5, 7))
       xopt_ = 0xc160; // conv kernel
@@ -20,7 +29,7 @@ Instance_elx_int8_conv_direct_t::elx_int8_conv_direct_t(eld_conv_t &dc)
       xopt_ = 0xa160; // gemm kernel
   }
 
-  mthr_ = estl::max_concurrency();
+  mthr_ = ep.nthreads;
 
   ep.Vx = 4;
   ep.V1 = V / ep.Vx;
@@ -140,7 +149,10 @@ Template_elx_int8_conv_direct_t
 int Instance_elx_int8_conv_direct_t::prepare_execute_opt()
 {
   if (ep.with_ip_sum && ep.with_relu && ep.output_fmt != nChw16c) {
-    el_error("Unimplemented: fuse sum (plain format) and relu together");
+    // Relu after the sum, by the post-op pass
+    if (ep.output_data_type != f32)
+      el_error("Unimplemented: fuse sum (plain format) and relu together");
+    post_ops_defer_relu(ep);
   }
   size_t tweights_size = 0, tinput_size = 0, toutput_size = 0;
   size_t tweights_s8_size = 0, input_scale_size = 0, weights_scale_size = 0,
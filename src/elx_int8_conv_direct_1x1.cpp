@@ -2,6 +2,7 @@
 #include "elx_int8_conv_direct_1x1_bind.hpp"
 #include "elx_int8_conv_direct_1x1_xopt.hpp"
 #include "el_parallel.hpp"
+#include "elx_conv_cost.hpp"
 
 namespace euler {
 
@@ -10,8 +11,16 @@ Instance_elx_int8_conv_direct_1x1_t::elx_int8_conv_direct_1x1_t(eld_conv_t &dc)
     : elx_conv_t(dc)
 {
   // user input
-  //xopt_ = ep.execution_mode;
-  xopt_ = 0xa160;
+  xopt_ = ep.execution_mode;
+  if (xopt_ != 0 && !conv_xopt_supported(conv_cost_shape(dc),
+                                         CONV_DIRECT_1X1, xopt_)) {
+    el_warn("direct_1x1: int8: execution-mode not supported, ignored");
+    xopt_ = 0;
+  }
+  if (xopt_ == 0)
+    xopt_ = conv_xopt_plan(dc, CONV_DIRECT_1X1);
+  if (xopt_ == 0)
+    xopt_ = 0xa160;
   attr_ = 0x0;
 
   ep.Vx = 4;
@@ -92,7 +101,7 @@ Instance_elx_int8_conv_direct_1x1_t::elx_int8_conv_direct_1x1_t(eld_conv_t &dc)
   attr_ = set_bit(attr_, AT_FMAOPT_MASK);
   is_first_run_ = true;
   inference_acc_ = false;
-  mthr_ = estl::max_concurrency();
+  mthr_ = ep.nthreads;
   inference_acc_ = ep.prop_kind == forward_inference;
 
   attr_ = ep.with_bias ? set_bit(attr_, AT_BIAS_MASK) : attr_;
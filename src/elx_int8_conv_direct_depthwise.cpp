@@ -17,7 +17,7 @@ Instance_elx_int8_conv_direct_depthwise_t::elx_int8_conv_direct_depthwise_t(eld_
 {
   // user input
   xopt_ = ep.execution_mode;
-  mthr_ = estl::max_concurrency();
+  mthr_ = ep.nthreads;
 
   ep.grp = ep.g;
   ep.Vx = 1;
@@ -1,4 +1,5 @@
 #include "el_parallel.hpp"
+#include "elx_conv_cost.hpp"
 #include "elx_int8_conv_wino.hpp"
 #include "elx_int8_conv_wino_bind.hpp"
 #include "elx_int8_conv_wino_xopt.hpp"
@@ -52,6 +53,8 @@ Template_elx_int8_conv_wino_t Instance_elx_int8_conv_wino_t::elx_int8_conv_wino_
   ep.I3 = ep.ic2 / ep.I2;
 
   ep.t2 = (ep.t + ep.T - 1) / ep.T;
+  if (xopt_ == 0)
+    xopt_ = conv_xopt_plan(dc, CONV_WINOGRAD, A);
   if (xopt_ == 0) {
     auto t2_th = ep.t2 / mthr_;
     xopt_ = t2_th > 1 ? 0xa161 : 0xa133;
@@ -61,7 +61,7 @@ void Instance_elx_int8_conv_wino_t::__execute_a133(
       THREAD_BARRIER()
       trans_output(output, toutput_, &md2(abias, _O4, 0), _O4, _I4);
     }}
-  }
+  };
 
   if (is_first_run_ && inference_acc_)
     is_first_run_ = false;
@@ -80,7 +80,8 @@ void Instance_elx_int8_conv_wino_t::__execute_a161(
   }
 
   auto t2_history = -1;
-  estl::parallel_for<2>([&, t2_history](int _t2, int _O4) mutable {
+  estl::parallel_for_dynamic<2>(mthr_, 1,
+      [&, t2_history](int _t2, int _O4) mutable {
     int ithr = estl::current_thread_index();
     MD2(TinputType, atinput2, tinput_, mthr_, ep.sampling_kind == COARSE ?
         A * A * ep.IC * ep.T : A * A * ep.I2 * V);
@@ -0,0 +1,391 @@
+#include <float.h>
+#include <math.h>
+#include <string.h>
+#include "el_def.hpp"
+#include "el_utils.hpp"
+#include "el_stl.hpp"
+#include "el_parallel.hpp"
+#include "elx_post_ops.hpp"
+
+namespace euler {
+
+// Per-channel vectors are kept in registers, one pair per op
+#define POST_OPS_MAX 8
+
+static inline void clip_compose(post_ops_split_t &s, float lo, float hi) {
+  s.lower = estl::min(estl::max(s.lower, lo), hi);
+  s.upper = estl::min(estl::max(s.upper, lo), hi);
+}
+
+bool post_ops_foldable(const eld_conv_t &desc)
+{
+  return desc.data_type.weights == f32 && desc.data_type.bias == f32
+      && desc.algorithm != DECONV_DIRECT;
+}
+
+bool post_ops_split(const std::vector<eld_post_op_t> &ops,
+                    post_ops_split_t &s, bool foldable)
+{
+  s = { false, false, false, false, 1.f, -FLT_MAX, FLT_MAX,
+        EL_NO_CALI, EL_NO_CALI, -1, 0, 0, -1 };
+  int n = ops.size(), i = 0;
+  if (post_ops_pool(ops) != nullptr) {
+    s.pool = n - 1;
+    --n;
+  } else if (n > 0 && ops[n - 1].kind == POST_OP_QUANTIZE) {
+    s.quantize = true;
+    s.quant_S = ops[n - 1].alpha;
+    s.quant_z = ops[n - 1].beta;
+    --n;
+  }
+  if (i < n && ops[i].kind == POST_OP_BIAS) {
+    s.bias = true;
+    ++i;
+  }
+  if (foldable && i < n && ops[i].kind == POST_OP_SCALE_SHIFT) {
+    s.fold = i;
+    ++i;
+  }
+  if (i < n && ops[i].kind == POST_OP_SUM) {
+    s.sum = true;
+    s.sum_scale = ops[i].alpha;
+    ++i;
+  }
+  for (; i < n; ++i) {
+    if (ops[i].kind == POST_OP_RELU)
+      clip_compose(s, 0.f, FLT_MAX);
+    else if (ops[i].kind == POST_OP_CLIP)
+      clip_compose(s, ops[i].alpha, ops[i].beta);
+    else
+      break;
+    s.relu = true;
+  }
+  s.tail_begin = i;
+  s.tail_end = n;
+
+  // No bias/sum/quantize after an activation, one slot kept for
+  // post_ops_defer_relu()
+  if (n - i > POST_OPS_MAX - 1)
+    return false;
+  for (; i < n; ++i) {
+    if (!estl::any_of(ops[i].kind, POST_OP_RELU, POST_OP_LEAKY_RELU,
+                      POST_OP_ELU, POST_OP_SWISH, POST_OP_GELU, POST_OP_CLIP,
+                      POST_OP_SCALE_SHIFT))
+      return false;
+  }
+  return true;
+}
+
+int post_ops_lower(eld_conv_t &desc)
+{
+  post_ops_split_t s;
+  if (!post_ops_split(desc.post_ops, s, post_ops_foldable(desc))) {
+    el_error("Post-ops: unsupported kind or order");
+    return ELD_UNIMPLEMENTED;
+  }
+  desc.with_bias = s.bias;
+  desc.with_ip_sum = s.sum;
+  desc.with_relu = s.relu;
+  if (s.relu) {
+    desc.relu_bound.lower = s.lower;
+    desc.relu_bound.upper = s.upper;
+  }
+  if (s.quantize) {
+    if (!estl::any_of(desc.data_type.output, u8, s8)) {
+      el_error("Post-ops: quantize to non int8 output");
+      return ELD_UNIMPLEMENTED;
+    }
+    desc.output_quant = { s.quant_S, s.quant_z };
+  }
+  if (s.pool >= 0) {
+    auto &p = desc.post_ops[s.pool].pool;
+    int ph, pw;
+    post_ops_pool_dims(desc, desc.post_ops[s.pool], ph, pw);
+    if (p.kh <= 0 || p.kw <= 0 || p.sh <= 0 || p.sw <= 0 || p.t < 0
+        || p.l < 0 || p.t >= p.kh || p.l >= p.kw || ph <= 0 || pw <= 0) {
+      el_error("Post-ops: invalid pooling window");
+      return ELD_GENERAL_ERROR;
+    }
+    if (desc.data_type.output != f32 || s.sum
+        || desc.algorithm == DECONV_DIRECT) {
+      el_error("Post-ops: pooling on non f32 output, sum or deconv");
+      return ELD_UNIMPLEMENTED;
+    }
+  }
+  if ((s.tail_begin < s.tail_end || s.sum_scale != 1.f)
+      && desc.data_type.output != f32) {
+    el_error("Post-ops: scaled sum or activation other than relu/clip "
+             "on non f32 output");
+    return ELD_UNIMPLEMENTED;
+  }
+  return ELD_OK;
+}
+
+void post_ops_init(elx_param_t &ep, const eld_conv_t &desc)
+{
+  ep.sum_scale = 1.f;
+  ep.sum_scale_fused = false;
+  ep.post_ops.clear();
+  ep.post_ops_fused = false;
+
+  post_ops_split_t s;
+  if (desc.post_ops.empty()
+      || !post_ops_split(desc.post_ops, s, post_ops_foldable(desc)))
+    return;
+  ep.sum_scale = s.sum_scale;
+  int OC = ALIGNUP(desc.dims.oc, 16);
+  for (int i = s.tail_begin; i < s.tail_end; ++i) {
+    auto &op = desc.post_ops[i];
+    elx_post_op_t xop;
+    xop.kind = op.kind;
+    xop.alpha = op.alpha;
+    xop.beta = op.beta;
+    if (op.kind == POST_OP_SCALE_SHIFT) {
+      xop.scale.assign(OC, 1.f);
+      xop.shift.assign(OC, 0.f);
+      for (int c = 0; c < desc.dims.oc; ++c) {
+        if (op.scale != nullptr) xop.scale[c] = op.scale[c];
+        if (op.shift != nullptr) xop.shift[c] = op.shift[c];
+      }
+    }
+    ep.post_ops.push_back(std::move(xop));
+  }
+}
+
+void post_ops_defer_relu(elx_param_t &ep)
+{
+  if (!ep.with_relu)
+    return;
+  elx_post_op_t clip;
+  clip.kind = POST_OP_CLIP;
+  clip.alpha = ep.relu_bound_lower;
+  clip.beta = ep.relu_bound_upper;
+  ep.post_ops.insert(ep.post_ops.begin(), clip);
+  ep.with_relu = false;
+  ep.post_ops_fused = false;
+}
+
+bool post_ops_eltwise(const elx_param_t &ep)
+{
+  for (auto &op : ep.post_ops)
+    if (op.kind == POST_OP_SCALE_SHIFT)
+      return false;
+  return true;
+}
+
+const eld_post_op_t *post_ops_pool(const std::vector<eld_post_op_t> &ops)
+{
+  if (ops.empty() || !estl::any_of(ops.back().kind, POST_OP_MAX_POOL,
+                                   POST_OP_AVG_POOL))
+    return nullptr;
+  return &ops.back();
+}
+
+void post_ops_pool_dims(const eld_conv_t &desc, const eld_post_op_t &pool,
+                        int &ph, int &pw)
+{
+  auto &p = pool.pool;
+  int h = desc.dims.oh + 2 * p.t - p.kh, w = desc.dims.ow + 2 * p.l - p.kw;
+  ph = p.sh > 0 && h >= 0 ? h / p.sh + 1 : 0;
+  pw = p.sw > 0 && w >= 0 ? w / p.sw + 1 : 0;
+}
+
+post_ops_fold_t *post_ops_fold_init(const eld_conv_t &desc)
+{
+  post_ops_split_t s;
+  bool foldable = post_ops_foldable(desc);
+  bool with_fold = !desc.post_ops.empty()
+      && post_ops_split(desc.post_ops, s, foldable) && s.fold >= 0;
+  if (!foldable || (!desc.with_batch_norm && !with_fold))
+    return nullptr;
+
+  auto f = new post_ops_fold_t;
+  int OC = ALIGNUP(desc.dims.oc, 16);
+  f->scale.assign(OC, 1.f);
+  f->shift.assign(OC, 0.f);
+  f->g = desc.dims.g;
+  f->ic = desc.dims.ic;
+  f->oc = desc.dims.oc;
+  f->kh = desc.dims.kh;
+  f->kw = desc.dims.kw;
+  f->weights_fmt = desc.formats.weights;
+  f->with_bias = desc.with_bias;
+  f->bias = nullptr;
+  f->done = false;
+
+  if (desc.with_batch_norm) {
+    auto &bn = desc.batch_norm;
+    for (int c = 0; c < desc.dims.oc; ++c) {
+      float gamma = bn.gamma != nullptr ? bn.gamma[c] : 1.f;
+      float beta = bn.beta != nullptr ? bn.beta[c] : 0.f;
+      f->scale[c] = gamma / sqrtf(bn.var[c] + bn.epsilon);
+      f->shift[c] = beta - bn.mean[c] * f->scale[c];
+    }
+  }
+  if (with_fold) {
+    auto &op = desc.post_ops[s.fold];
+    for (int c = 0; c < desc.dims.oc; ++c) {
+      float scale = op.scale != nullptr ? op.scale[c] : 1.f;
+      float shift = op.shift != nullptr ? op.shift[c] : 0.f;
+      f->scale[c] *= scale;
+      f->shift[c] = f->shift[c] * scale + shift;
+    }
+  }
+  return f;
+}
+
+float *post_ops_fold(post_ops_fold_t &f, const float *weights,
+                     const float *bias)
+{
+  int OC = f.scale.size();
+  if (f.bias == nullptr && memalign64(&f.bias, OC * sizeof(float)) != 0)
+    el_error("Batch norm: folded bias allocation failed");
+  bool with_bias = f.with_bias && bias != nullptr;
+  for (int c = 0; c < OC; ++c)
+    f.bias[c] = (with_bias && c < f.oc ? bias[c] * f.scale[c] : 0.f)
+        + f.shift[c];
+
+  int icg = f.ic / f.g, ocg = f.oc / f.g, khw = f.kh * f.kw;
+  int V = estl::any_of(f.weights_fmt, OIhw16i16o, gOIhw16i16o) ? 16
+        : estl::any_of(f.weights_fmt, OIhw8i8o, gOIhw8i8o) ? 8 : 1;
+  int O2 = ALIGNUP(ocg, V) / V, I2 = ALIGNUP(icg, V) / V;
+  size_t size = (size_t)f.g * O2 * I2 * V * V * khw;
+  // Engines read ahead of weights, see eld_conv_t::sizes
+  size_t pad = 4 * 16;
+  float *w;
+  if (memalign64(&w, (size + pad) * sizeof(float)) != 0) {
+    el_error("Batch norm: folded weights allocation failed");
+    return nullptr;
+  }
+  memset(w + size, 0, pad * sizeof(float));
+
+  if (V > 1) { // g, O2, I2, kh, kw, V(i), V(o)
+    int rows = f.g * O2 * I2 * khw * V;
+    estl::parallel_for<1>([&](int r) {
+      int go = r / (I2 * khw * V);
+      int _g = go / O2, _O2 = go % O2;
+      iter_each (_oV, V) {
+        int c = _O2 * V + _oV;
+        float s = c < ocg ? f.scale[_g * ocg + c] : 1.f;
+        w[(size_t)r * V + _oV] = weights[(size_t)r * V + _oV] * s;
+      }
+    }, rows);
+  } else if (estl::any_of(f.weights_fmt, hwio, ghwio)) {
+    // g, kh, kw, ic, oc
+    estl::parallel_for<1>([&](int r) {
+      int _g = r / (khw * icg);
+      iter_each (_o, ocg) {
+        w[(size_t)r * ocg + _o]
+            = weights[(size_t)r * ocg + _o] * f.scale[_g * ocg + _o];
+      }
+    }, f.g * khw * icg);
+  } else { // oihw, goihw: g, oc, ic, kh, kw
+    estl::parallel_for<1>([&](int c) {
+      size_t row = (size_t)icg * khw;
+      iter_each (_i, row)
+        w[c * row + _i] = weights[c * row + _i] * f.scale[c];
+    }, f.oc);
+  }
+  return w;
+}
+
+static inline size_t output_channels(const elx_param_t &ep)
+{
+  return ep.output_fmt == nChw16c ? ALIGNUP(ep.oc, 16)
+       : ep.output_fmt == nChw8c ? ALIGNUP(ep.oc, 8) : ep.oc;
+}
+
+void post_ops_scale_sum(const elx_param_t &ep, void *output)
+{
+  const size_t chunk = 16 * 1024;
+  size_t len = ep.n * ep.oh * ep.ow * output_channels(ep);
+  int nchunks = (len + chunk - 1) / chunk;
+  __m512 s = _mm512_set1_ps(ep.sum_scale);
+  estl::parallel_for<1>([&](int _c) {
+    float *p = (float *)output + _c * chunk;
+    size_t end = estl::min(chunk, len - _c * chunk);
+    for (size_t i = 0; i < end; i += 16) {
+      __mmask16 k = end - i >= 16 ? 0xffff : (1 << (end - i)) - 1;
+      __m512 v = _mm512_maskz_loadu_ps(k, p + i);
+      _mm512_mask_storeu_ps(p + i, k, _mm512_mul_ps(v, s));
+    }
+  }, nchunks);
+}
+
+// Apply ops to k lanes at p of channels c, c + cstride, ...
+struct post_ops_lanes_t {
+  int nops;
+  const elx_post_op_t *ops;
+  __m512 scale[POST_OPS_MAX], shift[POST_OPS_MAX];
+
+  post_ops_lanes_t(const elx_param_t &ep)
+      : nops(ep.post_ops.size()), ops(ep.post_ops.data()) {}
+
+  // Per-channel vectors of channels [c, c + 16) under k, or channel c
+  // broadcast
+  void load(int c, __mmask16 k, bool broadcast) {
+    for (int j = 0; j < nops; ++j) {
+      if (ops[j].kind != POST_OP_SCALE_SHIFT)
+        continue;
+      if (broadcast) {
+        scale[j] = _mm512_set1_ps(ops[j].scale[c]);
+        shift[j] = _mm512_set1_ps(ops[j].shift[c]);
+      } else {
+        scale[j] = _mm512_maskz_loadu_ps(k, &ops[j].scale[c]);
+        shift[j] = _mm512_maskz_loadu_ps(k, &ops[j].shift[c]);
+      }
+    }
+  }
+
+  void apply(float *p, __mmask16 k) {
+    __m512 v = _mm512_maskz_loadu_ps(k, p);
+    for (int j = 0; j < nops; ++j)
+      v = post_op_apply(ops[j], v, scale[j], shift[j]);
+    _mm512_mask_storeu_ps(p, k, v);
+  }
+};
+
+void post_ops_execute(const elx_param_t &ep, void *output)
+{
+  float *out = (float *)output;
+  int hw = ep.oh * ep.ow;
+  auto tail_mask = [](int n) -> __mmask16 {
+    return n >= 16 ? 0xffff : (1 << n) - 1;
+  };
+
+  if (ep.output_fmt == nChw16c || ep.output_fmt == nChw8c) {
+    int V = ep.output_fmt == nChw16c ? 16 : 8;
+    int C = output_channels(ep) / V;
+    __mmask16 k = tail_mask(V);
+    estl::parallel_for<2>([&](int _n, int _C) {
+      post_ops_lanes_t lanes(ep);
+      lanes.load(_C * V, k, false);
+      float *p = out + ((size_t)_n * C + _C) * hw * V;
+      for (int i = 0; i < hw; ++i)
+        lanes.apply(p + i * V, k);
+    }, ep.n, C);
+  } else if (ep.output_fmt == nchw) {
+    estl::parallel_for<2>([&](int _n, int _c) {
+      post_ops_lanes_t lanes(ep);
+      lanes.load(_c, 0xffff, true);
+      float *p = out + ((size_t)_n * ep.oc + _c) * hw;
+      for (int i = 0; i < hw; i += 16)
+        lanes.apply(p + i, tail_mask(hw - i));
+    }, ep.n, ep.oc);
+  } else { // nhwc
+    int nrows = 64;
+    int nblks = (ep.n * hw + nrows - 1) / nrows;
+    estl::parallel_for<1>([&](int _b) {
+      post_ops_lanes_t lanes(ep);
+      int end = estl::min((_b + 1) * nrows, ep.n * hw);
+      for (int c = 0; c < ep.oc; c += 16) {
+        __mmask16 k = tail_mask(ep.oc - c);
+        lanes.load(c, k, false);
+        for (int r = _b * nrows; r < end; ++r)
+          lanes.apply(out + (size_t)r * ep.oc + c, k);
+      }
+    }, nblks);
+  }
+}
+
+}  // namespace euler
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <stdlib.h>
+#include <vector>
+#include "euler.hpp"
+#include "el_intrin.hpp"
+#include "elx_conv.hpp"
+
+namespace euler {
+
+// Post-op list of a desc split into the fused flags and the rest
+//
+// Leading bias, sum and relu/clip ops (in this order) map to with_bias,
+// with_ip_sum and with_relu/relu_bound, and a trailing quantize to
+// output_quant. A scale_shift right after the bias is folded into weights
+// if foldable. ops[tail_begin, tail_end) run after them, then a trailing
+// pooling op.
+struct post_ops_split_t {
+  bool bias, sum, relu, quantize;
+  float sum_scale, lower, upper, quant_S, quant_z;
+  int fold; // index of the folded scale_shift, -1 for none
+  int tail_begin, tail_end;
+  int pool; // index of the pooling op, -1 for none
+};
+
+bool post_ops_split(const std::vector<eld_post_op_t> &ops,
+                    post_ops_split_t &split, bool foldable);
+// Per-channel scale/shift can be folded into weights and bias of desc
+bool post_ops_foldable(const eld_conv_t &desc);
+// Set fused flags of desc from desc.post_ops
+int post_ops_lower(eld_conv_t &desc);
+// Tail of desc.post_ops to ep.post_ops
+void post_ops_init(elx_param_t &ep, const eld_conv_t &desc);
+// Move relu/relu_bound to the front of the tail, for engines summing
+// after their relu point
+void post_ops_defer_relu(elx_param_t &ep);
+// Tail has no per-channel op, i.e. can be fused on output store
+bool post_ops_eltwise(const elx_param_t &ep);
+// Trailing pooling op of ops, or nullptr
+const eld_post_op_t *post_ops_pool(const std::vector<eld_post_op_t> &ops);
+// Pooled output height/width of desc
+void post_ops_pool_dims(const eld_conv_t &desc, const eld_post_op_t &pool,
+                        int &ph, int &pw);
+
+// Batch norm and folded scale_shift of a desc
+//
+// Weights are scaled per output channel into a copy on first execution,
+// which the engine transforms and caches like user weights. The folded
+// bias, scale * bias + shift, is kept for later executions.
+struct post_ops_fold_t {
+  ~post_ops_fold_t() { ::free(bias); }
+  std::vector<float> scale, shift; // ALIGNUP(oc, 16)
+  int g, ic, oc, kh, kw, weights_fmt;
+  // User bias is read only if desc.with_bias, else it may be a placeholder
+  bool with_bias;
+  float *bias;
+  bool done;
+};
+
+// nullptr if desc has nothing to fold
+post_ops_fold_t *post_ops_fold_init(const eld_conv_t &desc);
+// Folded copy of weights, free()d by the caller, and fold.bias from bias
+float *post_ops_fold(post_ops_fold_t &fold, const float *weights,
+                     const float *bias);
+
+// Scale output by ep.sum_scale before the inplace sum
+void post_ops_scale_sum(const elx_param_t &ep, void *output);
+// Apply ep.post_ops over the output
+void post_ops_execute(const elx_param_t &ep, void *output);
+
+#ifdef __AVX512F__
+static inline __m512 post_op_exp(__m512 x) {
+  // exp(x) = 2^n * exp(r), x = n * ln2 + r
+  x = _mm512_max_ps(x, _mm512_set1_ps(-87.3f));
+  x = _mm512_min_ps(x, _mm512_set1_ps(88.3f));
+  __m512 n = _mm512_roundscale_ps(
+      _mm512_mul_ps(x, _mm512_set1_ps(1.442695041f)),
+      _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  __m512 r = _mm512_fnmadd_ps(n, _mm512_set1_ps(0.693145752f), x);
+  r = _mm512_fnmadd_ps(n, _mm512_set1_ps(1.428606765e-6f), r);
+  __m512 p = _mm512_set1_ps(1.f / 120);
+  p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(1.f / 24));
+  p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(1.f / 6));
+  p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(0.5f));
+  p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(1.f));
+  p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(1.f));
+  return _mm512_scalef_ps(p, n);
+}
+
+static inline __m512 post_op_sigmoid(__m512 x) {
+  __m512 one = _mm512_set1_ps(1.f);
+  __m512 e = post_op_exp(_mm512_sub_ps(_mm512_setzero_ps(), x));
+  return _mm512_div_ps(one, _mm512_add_ps(one, e));
+}
+
+// x: results of 16 channels, scale/shift: their POST_OP_SCALE_SHIFT
+static inline __m512 post_op_apply(const elx_post_op_t &op, __m512 x,
+                                   __m512 scale, __m512 shift) {
+  __m512 zero = _mm512_setzero_ps();
+  switch (op.kind) {
+  case POST_OP_RELU:
+    return _mm512_max_ps(x, zero);
+  case POST_OP_LEAKY_RELU: {
+    __mmask16 k = _mm512_cmp_ps_mask(x, zero, _CMP_GT_OQ);
+    return _mm512_mask_blend_ps(
+        k, _mm512_mul_ps(x, _mm512_set1_ps(op.alpha)), x);
+  }
+  case POST_OP_ELU: {
+    __mmask16 k = _mm512_cmp_ps_mask(x, zero, _CMP_GT_OQ);
+    __m512 e = _mm512_sub_ps(post_op_exp(x), _mm512_set1_ps(1.f));
+    return _mm512_mask_blend_ps(
+        k, _mm512_mul_ps(e, _mm512_set1_ps(op.alpha)), x);
+  }
+  case POST_OP_SWISH:
+    return _mm512_mul_ps(
+        x, post_op_sigmoid(_mm512_mul_ps(x, _mm512_set1_ps(op.alpha))));
+  case POST_OP_GELU: {
+    // 0.5x(1 + tanh(u)) = x * sigmoid(2u)
+    // u = sqrt(2/pi) * (x + 0.044715x^3)
+    __m512 x3 = _mm512_mul_ps(_mm512_mul_ps(x, x), x);
+    __m512 u = _mm512_fmadd_ps(x3, _mm512_set1_ps(0.044715f), x);
+    u = _mm512_mul_ps(u, _mm512_set1_ps(2 * 0.7978845608f));
+    return _mm512_mul_ps(x, post_op_sigmoid(u));
+  }
+  case POST_OP_CLIP:
+    x = _mm512_max_ps(x, _mm512_set1_ps(op.alpha));
+    return _mm512_min_ps(x, _mm512_set1_ps(op.beta));
+  case POST_OP_SCALE_SHIFT:
+    return _mm512_fmadd_ps(x, scale, shift);
+  default:
+    return x;
+  }
+}
+#endif
+
+// Elementwise tail on output store, see post_ops_eltwise()
+template <int V> static inline __m<V> post_ops_apply(const elx_param_t &,
+                                                     __m<V> x) {
+  return x;
+}
+
+#ifdef __AVX512F__
+template <> inline __m<16> post_ops_apply<16>(const elx_param_t &ep,
+                                              __m<16> x) {
+  __m512 one = _mm512_set1_ps(1.f), zero = _mm512_setzero_ps();
+  for (auto &op : ep.post_ops)
+    x = post_op_apply(op, x, one, zero);
+  return x;
+}
+#endif
+
+// Whole tail on output store, x: output channels [c, c + V)
+template <int V> static inline __m<V> post_ops_apply(const elx_param_t &,
+                                                     __m<V> x, int) {
+  return x;
+}
+
+#ifdef __AVX512F__
+template <> inline __m<16> post_ops_apply<16>(const elx_param_t &ep,
+                                              __m<16> x, int c) {
+  __m512 one = _mm512_set1_ps(1.f), zero = _mm512_setzero_ps();
+  for (auto &op : ep.post_ops) {
+    if (op.kind == POST_OP_SCALE_SHIFT)
+      x = post_op_apply(op, x, _mm512_loadu_ps(&op.scale[c]),
+                        _mm512_loadu_ps(&op.shift[c]));
+    else
+      x = post_op_apply(op, x, one, zero);
+  }
+  return x;
+}
+#endif
+
+}  // namespace euler
@@ -1,100 +1,385 @@
+#include <limits.h>
+#include <sched.h>
 #include <unistd.h>
+#include <linux/futex.h>
 #include <sys/syscall.h>
 #include <sys/types.h>
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <unordered_map>
 #include "elx_stream.hpp"
 #include "elx_conv.hpp"
 #include "el_init.hpp"
+#include "el_numa.hpp"
+#include "el_parallel.hpp"
 
 #define gettid() syscall(SYS_gettid)
 
 namespace euler {
 
-elx_stream global_stream;
+#define STREAM_CAPACITY 1024
+#define STREAM_SPIN 4096
 
-struct elx_eol_t : public elx_conv_t {
-public:
-  elx_eol_t(eld_conv_t &dc) : elx_conv_t(dc) {
-    ep.eager_mode = false;
-    ep.stream_sync = true;
-    ep.shared_workspace_enabled = false;
+static inline void futex_wait(std::atomic<int> *addr, int val) {
+  syscall(SYS_futex, (int *)addr, FUTEX_WAIT_PRIVATE, val, nullptr, nullptr, 0);
+}
+
+static inline void futex_wake(std::atomic<int> *addr, int n) {
+  syscall(SYS_futex, (int *)addr, FUTEX_WAKE_PRIVATE, n, nullptr, nullptr, 0);
+}
+
+static inline void cpu_relax() {
+  __builtin_ia32_pause();
+}
 
-    on_destroy_ = ELX_EVENT_EXIT; // signal exit
+#define THEN_CLOSED ((then_node_t *)1)
+
+void elx_event_t::signal() {
+  done_.store(1, std::memory_order_seq_cst);
+  if (waiters_.load(std::memory_order_seq_cst) > 0)
+    futex_wake(&done_, INT_MAX);
+
+  then_node_t *node = then_.exchange(THEN_CLOSED, std::memory_order_acq_rel);
+  while (node != nullptr) {
+    then_node_t *next = node->next;
+    node->fn();
+    delete node;
+    node = next;
   }
+}
 
-  virtual void execute(void *output, void *input, void *weights, void *bias) {}
-  virtual ~elx_eol_t() {}
+void elx_event_t::then(std::function<void()> fn) {
+  then_node_t *node = new then_node_t { std::move(fn), nullptr };
+  then_node_t *head = then_.load(std::memory_order_acquire);
+  do {
+    if (head == THEN_CLOSED) {
+      node->fn();
+      delete node;
+      return;
+    }
+    node->next = head;
+  } while (!then_.compare_exchange_weak(head, node,
+                                        std::memory_order_acq_rel));
+}
+
+void elx_event_t::wait() {
+  for (int i = 0; i < STREAM_SPIN; ++i) {
+    if (query())
+      return;
+    cpu_relax();
+  }
+  waiters_.fetch_add(1, std::memory_order_seq_cst);
+  while (done_.load(std::memory_order_seq_cst) == 0)
+    futex_wait(&done_, 0);
+  waiters_.fetch_sub(1, std::memory_order_relaxed);
+}
 
-private:
-  virtual void set_workspace_buffers(void *base) {}
-  virtual void set_scratch_buffers(void *base) {}
+// Worker teams
+//
+// A stream worker and the threads of its parallel regions run on a CPU
+// set of its team size (ep.nthreads), carved from the stream's CPUs
+// disjoint from the sets of other workers while CPUs last, so that
+// layers on separate streams run concurrently on separate cores. Each
+// team thread is pinned to one CPU of the set.
+struct team_cpus_t {
+  std::mutex mu;
+  std::vector<int> allowed; // process affinity, ascending
+  std::vector<int> owners;  // teams per CPU id
 };
 
-int set_cpu_affinity() {
-  // TODO
+static team_cpus_t &team_cpus() {
+  static auto *tc = []() {
+    auto *t = new team_cpus_t;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+      for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        if (CPU_ISSET(cpu, &set))
+          t->allowed.push_back(cpu);
+    }
+    t->owners.resize(CPU_SETSIZE, 0);
+    return t;
+  }();
+  return *tc;
+}
+
+// CPUs of spec within the process affinity, all allowed CPUs if none
+static std::vector<int> stream_cpus(const char *spec) {
+  auto &allowed = team_cpus().allowed;
+  if (spec == nullptr)
+    return allowed;
+
+  std::vector<int> cpus, pool;
+  if (!el_parse_cpus(spec, cpus)) {
+    el_warn("stream: invalid CPU list, using process affinity");
+    return allowed;
+  }
+  std::set_intersection(cpus.begin(), cpus.end(), allowed.begin(),
+                        allowed.end(), std::back_inserter(pool));
+  if (pool.empty()) {
+    el_warn("stream: no allowed CPU in CPU list, using process affinity");
+    return allowed;
+  }
+  return pool;
+}
+
+// Least used window of nthr adjacent CPUs of pool, the first free one
+// if any. pool is guarded by the team lock.
+static std::vector<int> team_reserve(const std::vector<int> &pool, int nthr) {
+  auto &t = team_cpus();
+  std::lock_guard<std::mutex> lock(t.mu);
+  int ncpus = pool.size();
+  nthr = std::min(nthr, ncpus);
+  if (nthr <= 0)
+    return {};
+
+  int best = 0, best_load = INT_MAX;
+  for (int i = 0; i + nthr <= ncpus; ++i) {
+    int load = 0;
+    for (int j = i; j < i + nthr; ++j)
+      load += t.owners[pool[j]];
+    if (load < best_load) {
+      best = i;
+      best_load = load;
+    }
+    if (load == 0)
+      break;
+  }
+  if (best_load > 0)
+    el_log(__WARN, "stream: team of %d threads overlaps other teams", nthr);
+
+  std::vector<int> team(pool.begin() + best, pool.begin() + best + nthr);
+  for (auto cpu : team)
+    t.owners[cpu]++;
+  return team;
+}
+
+static void team_release(const std::vector<int> &team) {
+  auto &t = team_cpus();
+  std::lock_guard<std::mutex> lock(t.mu);
+  for (auto cpu : team)
+    t.owners[cpu]--;
+}
+
+// Pin calling thread to cpus
+static int set_cpu_affinity(const std::vector<int> &cpus) {
+  if (cpus.empty())
+    return 0;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (auto cpu : cpus)
+    CPU_SET(cpu, &set);
+  if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+    el_warn("stream: sched_setaffinity failed");
+    return -1;
+  }
   return 0;
 }
 
-elx_stream::elx_stream() {
-  _threadx = new std::thread([&]{
-    set_cpu_affinity();
-    // executor thread
-    while (run());
-  });
-  _threadx->detach();
+static void team_bind(const std::vector<int> &team, int nthr) {
+  if (team.empty())
+    return;
+  // Executor keeps the team set under TBB, whose arena threads are not
+  // bound to a team
+  set_cpu_affinity(team);
+#if MT_RUNTIME == MT_RUNTIME_OMP || MT_RUNTIME == MT_RUNTIME_NATIVE
+  estl::parallel_for<1>(nthr, [&](int ithr) {
+    set_cpu_affinity({ team[ithr % team.size()] });
+  }, nthr);
+#endif
+  el_log(__DEBUG, "stream: tid %ld team cpus %d-%d (%zu), threads=%d",
+         (long)gettid(), team.front(), team.back(), team.size(), nthr);
 }
 
-elx_stream::~elx_stream() {
+elx_stream::elx_stream(const std::string &name, int nworkers)
+    : name_(name), queue_(STREAM_CAPACITY), overflow_size_(0),
+      wake_seq_(0), sleepers_(0),
+      cpus_(stream_cpus(ego.stream_cpus)), cpus_gen_(0)
+{
+  for (int i = 0; i < nworkers; ++i) {
+    workers_.emplace_back([this]{
+      // executor thread, on stream CPUs until its team is known
+      {
+        std::lock_guard<std::mutex> lock(team_cpus().mu);
+        set_cpu_affinity(cpus_);
+      }
+      worker();
+    });
+  }
+}
+
+void elx_stream::set_cpus(const char *spec) {
+  auto cpus = stream_cpus(spec);
+  std::lock_guard<std::mutex> lock(team_cpus().mu);
+  cpus_ = cpus;
+  cpus_gen_.fetch_add(1, std::memory_order_release);
+}
 
-  eld_conv_t dummy;
-  elx_eol_t eol(dummy);
+elx_stream::~elx_stream() {
+  std::vector<elx_event> exits;
+  for (size_t i = 0; i < workers_.size(); ++i)
+    exits.push_back(submit(ELX_TASK_EXIT, nullptr));
+  for (auto &w : workers_)
+    w.join();
+}
 
-  delete _threadx;
+elx_event elx_stream::submit(int kind, elx_conv_t *xc, void *output,
+                             void *input, void *weights, void *bias) {
+  return submit(kind, xc, output, input, weights, bias, {});
 }
 
-void elx_stream::submit(elx_conv_t *ex) {
+elx_event elx_stream::submit(int kind, elx_conv_t *xc, void *output,
+                             void *input, void *weights, void *bias,
+                             const std::vector<elx_event> &deps,
+                             const elx_pads_t &pads) {
   // user thread
-  if (ex->ep.stream_sync)
-    ex->mu_.lock();
-  std::unique_lock<std::mutex> mlock(_mutex);
-  _stream.push(ex);
-  mlock.unlock();
-  _cond.notify_one();
-}
-
-int elx_stream::run() {
-  std::unique_lock<std::mutex> mlock(_mutex);
-  while(_stream.empty()) {
-    _cond.wait(mlock);
-  }
-  euler::elx_conv_t *ex = _stream.front();
-  _stream.pop();
-  mlock.unlock();
-
-  int ret = 1;
-  if (ex != nullptr) {
-    int event = ex->on_destroy();
-    if (event != ELX_EVENT_NORMAL) {
-      if (event == ELX_EVENT_TEARDOWN)
-        ex->teardown();
-      else if (event == ELX_EVENT_EXIT)
-        ret = 0;
+  elx_event event = std::make_shared<elx_event_t>();
+
+  // Submissions of one layer share its scratch and first-run state, and
+  // its teardown frees them: chain each onto the previous one, so that
+  // they run in order whichever workers pop them
+  std::vector<elx_event> pending;
+  if (xc != nullptr) {
+    elx_event prev = std::atomic_exchange(&xc->last_event_, event);
+    if (prev != nullptr && !prev->query())
+      pending.push_back(prev);
+  }
+  for (auto &d : deps) {
+    if (d != nullptr && !d->query())
+      pending.push_back(d);
+  }
+  if (pending.empty()) {
+    elx_task_t task = { kind, xc, output, input, weights, bias, pads, event };
+    push(task);
+    return event;
+  }
+
+  // Last signaled prerequisite enqueues the task
+  auto task = std::make_shared<elx_task_t>();
+  *task = { kind, xc, output, input, weights, bias, pads, event };
+  auto count = std::make_shared<std::atomic<int>>(pending.size());
+  for (auto &d : pending) {
+    d->then([this, task, count]() {
+      if (count->fetch_sub(1, std::memory_order_acq_rel) == 1)
+        push(*task, false);
+    });
+  }
+  return event;
+}
+
+void elx_stream::push(elx_task_t &task, bool blocking) {
+  if (blocking) {
+    while (!queue_.push(task))
+      std::this_thread::yield();
+  } else if (!queue_.push(task)) {
+    std::lock_guard<std::mutex> lock(overflow_mu_);
+    overflow_.push_back(std::move(task));
+    overflow_size_.fetch_add(1, std::memory_order_seq_cst);
+  }
+
+  // Order the cell publish (release) before the sleepers_ load, paired
+  // with the sleepers_ increment before pop in pop_wait. Otherwise a
+  // worker may park on a queued task while push reads no sleeper.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (sleepers_.load(std::memory_order_seq_cst) > 0) {
+    wake_seq_.fetch_add(1, std::memory_order_seq_cst);
+    futex_wake(&wake_seq_, 1);
+  }
+}
+
+// Spilled continuations first, they are older than queued submissions
+bool elx_stream::pop(elx_task_t &task) {
+  if (overflow_size_.load(std::memory_order_seq_cst) > 0) {
+    std::lock_guard<std::mutex> lock(overflow_mu_);
+    if (!overflow_.empty()) {
+      task = std::move(overflow_.front());
+      overflow_.pop_front();
+      overflow_size_.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return queue_.pop(task);
+}
+
+bool elx_stream::pop_wait(elx_task_t &task) {
+  for (int i = 0; i < STREAM_SPIN; ++i) {
+    if (pop(task))
+      return true;
+    cpu_relax();
+  }
+
+  // Park: re-check after announcing, a submit in between bumps wake_seq_
+  int seq = wake_seq_.load(std::memory_order_seq_cst);
+  sleepers_.fetch_add(1, std::memory_order_seq_cst);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  bool popped = pop(task);
+  if (!popped)
+    futex_wait(&wake_seq_, seq);
+  sleepers_.fetch_sub(1, std::memory_order_seq_cst);
+  return popped;
+}
+
+void elx_stream::worker() {
+  elx_task_t task;
+  std::vector<int> team;
+  int team_size = 0, team_gen = -1;
+  for (;;) {
+    if (!pop_wait(task))
+      continue;
+
+    bool exit = false;
+    elx_conv_t *ex = task.xc;
+    if (task.kind == ELX_TASK_EXIT) {
+      exit = true;
+    } else if (task.kind == ELX_TASK_TEARDOWN) {
+      ex->teardown();
     } else {
-      if (ego.verbose) {
-        ex->execute_verbose(ex->output_, ex->input_, ex->weights_, ex->bias_);
-      } else {
-        ex->execute(ex->output_, ex->input_, ex->weights_, ex->bias_);
+      int gen = cpus_gen_.load(std::memory_order_acquire);
+      if (ex->ep.nthreads != team_size || gen != team_gen) {
+        team_release(team);
+        team = team_reserve(cpus_, ex->ep.nthreads);
+        team_bind(team, ex->ep.nthreads);
+        team_size = ex->ep.nthreads;
+        team_gen = gen;
       }
+      // Pads and scratch are layer state: set them in submission order,
+      // not on the user thread while an earlier submission runs
+      auto &pads = task.pads;
+      ex->set_user_pads(pads.use_scratch_pad, pads.scratch_pad,
+                        pads.use_workspace_pad, pads.workspace_pad);
+      ex->set_scratch_buffers();
+      ex->execute_team(task.output, task.input, task.weights, task.bias);
     }
-    if (ex->ep.stream_sync) {
-      ex->mu_.unlock();
-    }
+    task.event->signal();
+    task.event.reset();
+    if (exit)
+      break;
   }
-  return ret;
+  team_release(team);
 }
 
-void elx_stream::wait(elx_conv_t *ex) {
-  // user thread
-  std::lock_guard<std::mutex> mlock(ex->mu_);
+elx_stream *elx_stream_get(const std::string &name) {
+  static std::mutex mu;
+  static auto *streams =
+      new std::unordered_map<std::string, elx_stream *>();
+
+  std::lock_guard<std::mutex> lock(mu);
+  auto it = streams->find(name);
+  if (it != streams->end())
+    return it->second;
+
+  // Over-aligned, by memalign64 rather than new
+  void *p = nullptr;
+  if (memalign64(&p, sizeof(elx_stream)) != 0) {
+    el_error("stream: allocation failed");
+    return nullptr;
+  }
+  auto *s = new (p) elx_stream(name, ego.stream_workers);
+  (*streams)[name] = s;
+  el_log(__DEBUG, "stream: %s: created, workers=%d", name.c_str(),
+         ego.stream_workers);
+  return s;
 }
 
 }
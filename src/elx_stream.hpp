@@ -1,32 +1,181 @@
 #pragma once
 
-#include <queue>
-#include <thread>
+#include <stdint.h>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
 #include <mutex>
-#include <condition_variable>
+#include <string>
+#include <thread>
+#include <vector>
+#include "euler.hpp"
 
 namespace euler {
 
 struct elx_conv_t;
 
+// Completion event of one stream submission
+class elx_event_t {
+public:
+  elx_event_t() : done_(0), waiters_(0), then_(nullptr) {}
+  void signal();
+  void wait();
+  bool query() const { return done_.load(std::memory_order_acquire) != 0; }
+  // Run fn on signal, or right away if already signaled
+  void then(std::function<void()> fn);
+
+private:
+  struct then_node_t {
+    std::function<void()> fn;
+    then_node_t *next;
+  };
+
+  std::atomic<int> done_;
+  std::atomic<int> waiters_;
+  // Lock-free continuation list, closed by signal()
+  std::atomic<then_node_t *> then_;
+};
+
+enum {
+  ELX_TASK_EXECUTE = 0,
+  ELX_TASK_TEARDOWN = 1,
+  ELX_TASK_EXIT = 2
+};
+
+// User scratch/workspace pads of one submission, applied by the worker
+struct elx_pads_t {
+  bool use_scratch_pad;
+  void *scratch_pad;
+  bool use_workspace_pad;
+  void *workspace_pad;
+};
+
+struct elx_task_t {
+  int kind;
+  elx_conv_t *xc;
+  void *output, *input, *weights, *bias;
+  elx_pads_t pads;
+  elx_event event;
+};
+
+// Bounded lock-free multi-producer multi-consumer ring, after D. Vyukov.
+// Capacity is a power of 2.
+template <typename T> class elx_mpmc_queue {
+public:
+  explicit elx_mpmc_queue(size_t capacity)
+      : cells_(new cell_t[capacity]), mask_(capacity - 1), head_(0), tail_(0)
+  {
+    for (size_t i = 0; i < capacity; ++i)
+      cells_[i].seq.store(i, std::memory_order_relaxed);
+  }
+
+  // v is moved from on success only
+  bool push(T &v) {
+    cell_t *cell;
+    size_t pos = tail_.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      size_t seq = cell->seq.load(std::memory_order_acquire);
+      intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+      if (diff == 0) {
+        if (tail_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        return false; // full
+      } else {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+    cell->data = std::move(v);
+    cell->seq.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &v) {
+    cell_t *cell;
+    size_t pos = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      size_t seq = cell->seq.load(std::memory_order_acquire);
+      intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+      if (diff == 0) {
+        if (head_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        return false; // empty
+      } else {
+        pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+    v = std::move(cell->data);
+    cell->seq.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+private:
+  struct cell_t {
+    std::atomic<size_t> seq;
+    T data;
+  };
+
+  std::unique_ptr<cell_t[]> cells_;
+  const size_t mask_;
+  alignas(64) std::atomic<size_t> head_;
+  alignas(64) std::atomic<size_t> tail_;
+};
+
+// Stream of submissions executed by nworkers threads. Submissions of one
+// layer run in submission order; with more workers, those of different
+// layers run concurrently and their order is up to the caller.
 class elx_stream {
 public:
-  elx_stream();
+  elx_stream(const std::string &name, int nworkers = 1);
   ~elx_stream();
-  void submit(elx_conv_t *ep);
-  void wait(elx_conv_t *ep);
-  int run();
+
+  elx_event submit(int kind, elx_conv_t *xc, void *output = nullptr,
+                   void *input = nullptr, void *weights = nullptr,
+                   void *bias = nullptr);
+  // Enqueue once all deps are signaled
+  elx_event submit(int kind, elx_conv_t *xc, void *output, void *input,
+                   void *weights, void *bias,
+                   const std::vector<elx_event> &deps,
+                   const elx_pads_t &pads = elx_pads_t());
+  const std::string &name() const { return name_; }
+  // Pin workers and their teams to CPUs of spec, see el_parse_cpus()
+  void set_cpus(const char *spec);
 
 private:
-  elx_stream& operator=(const elx_stream&) = delete;
-  elx_stream(const elx_stream&) = delete;
+  elx_stream &operator=(const elx_stream &) = delete;
+  elx_stream(const elx_stream &) = delete;
+
+  // Blocking push yields while the queue is full. Continuations must not
+  // block, they run on workers in signal(): they spill to overflow_.
+  void push(elx_task_t &task, bool blocking = true);
+  bool pop(elx_task_t &task);
+  void worker();
+  bool pop_wait(elx_task_t &task);
 
-  std::queue<elx_conv_t *> _stream;
-  mutable std::mutex _mutex;
-  std::condition_variable _cond;
-  std::thread *_threadx;
+  std::string name_;
+  elx_mpmc_queue<elx_task_t> queue_;
+  // Unbounded spill of continuations, drained ahead of queue_
+  std::mutex overflow_mu_;
+  std::deque<elx_task_t> overflow_;
+  std::atomic<int> overflow_size_;
+  // Idle workers park on wake_seq_
+  alignas(64) std::atomic<int> wake_seq_;
+  alignas(64) std::atomic<int> sleepers_;
+  // CPUs of worker teams, guarded by the team lock. Workers rebind on
+  // a cpus_gen_ change
+  std::vector<int> cpus_;
+  std::atomic<int> cpus_gen_;
+  std::vector<std::thread> workers_;
 };
 
-extern elx_stream global_stream;
+// Named stream registry, "" is the default stream. Streams are created on
+// first use with EULER_STREAM_WORKERS workers and live until process exit.
+elx_stream *elx_stream_get(const std::string &name);
 
 }
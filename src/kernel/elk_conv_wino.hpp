@@ -25,8 +25,12 @@ template <typename ToutputType, typename OutputType, typename BiasType,
     int format, bool is_border, bool with_bias, bool with_relu,
     bool with_ip_sum, int I, int A, int K, int V>
 struct elk_conv_wino_trans_output {
+  // attr: AT_POST_OPS_MASK applies ep.post_ops of output channels
+  // [oc, oc + V) on store. A sum is scaled by ep.sum_scale in its FMA if
+  // ep.sum_scale_fused.
   static void execute(elx_param_t &ep, OutputType *output,
-      ToutputType *toutput, BiasType *bias, int hOA_end, int wOA_end);
+      ToutputType *toutput, BiasType *bias, int hOA_end, int wOA_end,
+      int attr, int oc);
 };
 
 template <typename TweightsType, typename WeightsType, int I, int A, int K,
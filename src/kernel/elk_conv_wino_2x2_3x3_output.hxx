@@ -4,6 +4,7 @@
 #include "elk_def.hpp"
 #include "el_utils.hpp"
 #include "elk_conv_wino.hpp"
+#include "elx_post_ops.hpp"
 
 namespace euler {
 
@@ -16,7 +17,8 @@ struct elk_conv_wino_trans_output<float, OutputType, BiasType, format,
   constexpr static int K = 3;
 
   static void execute(elx_param_t &ep, OutputType *output,
-      float *toutput, BiasType *bias, int hOA_end, int wOA_end)
+      float *toutput, BiasType *bias, int hOA_end, int wOA_end,
+      int attr, int oc)
   {
     ENABLE_AVX512F();
 
@@ -33,6 +35,8 @@ struct elk_conv_wino_trans_output<float, OutputType, BiasType, format,
     bool fuse_ip_sum = with_ip_sum && (wOA_end != -1);
     bool fuse_bias = with_bias && (bias != nullptr);
     bool fuse_relu = with_relu && (bias != nullptr);
+    bool fuse_post_ops = test_bit(attr, AT_POST_OPS_MASK);
+    __m<V> msum = _mm<V>::set1_ps(ep.sum_scale_fused ? ep.sum_scale : 1.f);
 
     alignas(64) OutputType dummy[16];
     auto out_ptr = [&](int _h, int _w) {
@@ -123,10 +127,10 @@ struct elk_conv_wino_trans_output<float, OutputType, BiasType, format,
         p01 += _cvtepi8_ps(out_ptr(0, 1));
         p11 += _cvtepi8_ps(out_ptr(1, 1));
       } else {
-        p00 += *(__m<V>*)out_ptr(0, 0);
-        p10 += *(__m<V>*)out_ptr(1, 0);
-        p01 += *(__m<V>*)out_ptr(0, 1);
-        p11 += *(__m<V>*)out_ptr(1, 1);
+        p00 = _mm<V>::fmadd_ps(*(__m<V> *)out_ptr(0, 0), msum, p00);
+        p10 = _mm<V>::fmadd_ps(*(__m<V> *)out_ptr(1, 0), msum, p10);
+        p01 = _mm<V>::fmadd_ps(*(__m<V> *)out_ptr(0, 1), msum, p01);
+        p11 = _mm<V>::fmadd_ps(*(__m<V> *)out_ptr(1, 1), msum, p11);
       }
     }
     if (fuse_relu) {
@@ -135,6 +139,12 @@ struct elk_conv_wino_trans_output<float, OutputType, BiasType, format,
       p01 = _mm<V>::max_ps(p01, z);
       p11 = _mm<V>::max_ps(p11, z);
     }
+    if (fuse_post_ops) {
+      p00 = post_ops_apply<V>(ep, p00, oc);
+      p10 = post_ops_apply<V>(ep, p10, oc);
+      p01 = post_ops_apply<V>(ep, p01, oc);
+      p11 = post_ops_apply<V>(ep, p11, oc);
+    }
 
 #undef STORE
 #define p_(m, n) p##m##n
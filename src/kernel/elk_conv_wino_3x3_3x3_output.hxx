@@ -4,6 +4,7 @@
 #include "elk_def.hpp"
 #include "el_utils.hpp"
 #include "elk_conv_wino.hpp"
+#include "elx_post_ops.hpp"
 
 namespace euler {
 
@@ -16,7 +17,8 @@ struct elk_conv_wino_trans_output<float, OutputType, BiasType, format,
   constexpr static int K = 3;
 
   static void execute(elx_param_t &ep, OutputType *output,
-      float *toutput, BiasType *bias, int hOA_end, int wOA_end)
+      float *toutput, BiasType *bias, int hOA_end, int wOA_end,
+      int attr, int oc)
   {
     ENABLE_AVX512F();
 
@@ -32,6 +34,8 @@ struct elk_conv_wino_trans_output<float, OutputType, BiasType, format,
     bool fuse_ip_sum = with_ip_sum && (wOA_end != -1);
     bool fuse_bias = with_bias && (bias != nullptr);
     bool fuse_relu = with_relu && (bias != nullptr);
+    bool fuse_post_ops = test_bit(attr, AT_POST_OPS_MASK);
+    __m<V> msum = _mm<V>::set1_ps(ep.sum_scale_fused ? ep.sum_scale : 1.f);
 
     alignas(64) OutputType dummy[V];
     auto out_ptr = [&](int _h, int _w) {
@@ -149,9 +153,9 @@ struct elk_conv_wino_trans_output<float, OutputType, BiasType, format,
           p1 += _cvtepi8_ps(out_ptr(i, 1));
           p2 += _cvtepi8_ps(out_ptr(i, 2));
         } else {
-          p0 += *(__m<V> *)out_ptr(i, 0);
-          p1 += *(__m<V> *)out_ptr(i, 1);
-          p2 += *(__m<V> *)out_ptr(i, 2);
+          p0 = _mm<V>::fmadd_ps(*(__m<V> *)out_ptr(i, 0), msum, p0);
+          p1 = _mm<V>::fmadd_ps(*(__m<V> *)out_ptr(i, 1), msum, p1);
+          p2 = _mm<V>::fmadd_ps(*(__m<V> *)out_ptr(i, 2), msum, p2);
         }
       }
       if (fuse_relu) {
@@ -159,6 +163,11 @@ struct elk_conv_wino_trans_output<float, OutputType, BiasType, format,
         p1 = _mm<V>::max_ps(p1, z);
         p2 = _mm<V>::max_ps(p2, z);
       }
+      if (fuse_post_ops) {
+        p0 = post_ops_apply<V>(ep, p0, oc);
+        p1 = post_ops_apply<V>(ep, p1, oc);
+        p2 = post_ops_apply<V>(ep, p2, oc);
+      }
       STORE(i, 0)
       STORE(i, 1)
       STORE(i, 2)
@@ -5,6 +5,7 @@
 #include "elk_def.hpp"
 #include "el_utils.hpp"
 #include "elk_conv_wino.hpp"
+#include "elx_post_ops.hpp"
 
 namespace euler {
 
@@ -17,7 +18,8 @@ struct elk_conv_wino_trans_output<float,OutputType, BiasType, format,
   constexpr static int K = 3;
 
   static void execute(elx_param_t &ep, OutputType *output,
-      float *toutput, BiasType *bias, int hOA_end, int wOA_end)
+      float *toutput, BiasType *bias, int hOA_end, int wOA_end,
+      int attr, int oc)
   {
     __m<V> mrepS, mzp;
 
@@ -32,6 +34,8 @@ struct elk_conv_wino_trans_output<float,OutputType, BiasType, format,
     // TODO replace bias != nullptr with last_I4 condition
     bool fuse_bias = with_bias && (bias != nullptr);
     bool fuse_relu = with_relu && (bias != nullptr);
+    bool fuse_post_ops = test_bit(attr, AT_POST_OPS_MASK);
+    __m<V> msum = _mm<V>::set1_ps(ep.sum_scale_fused ? ep.sum_scale : 1.f);
 
     alignas(64) OutputType dummy[16];
     auto out_ptr = [&](int _h, int _w) {
@@ -181,10 +185,10 @@ struct elk_conv_wino_trans_output<float,OutputType, BiasType, format,
           p2 += _cvtepi8_ps(out_ptr(i, 2));
           p3 += _cvtepi8_ps(out_ptr(i, 3));
         } else {
-          p0 += *(__m<V> *)out_ptr(i, 0);
-          p1 += *(__m<V> *)out_ptr(i, 1);
-          p2 += *(__m<V> *)out_ptr(i, 2);
-          p3 += *(__m<V> *)out_ptr(i, 3);
+          p0 = _mm<V>::fmadd_ps(*(__m<V> *)out_ptr(i, 0), msum, p0);
+          p1 = _mm<V>::fmadd_ps(*(__m<V> *)out_ptr(i, 1), msum, p1);
+          p2 = _mm<V>::fmadd_ps(*(__m<V> *)out_ptr(i, 2), msum, p2);
+          p3 = _mm<V>::fmadd_ps(*(__m<V> *)out_ptr(i, 3), msum, p3);
         }
       }
       if (fuse_relu) {
@@ -193,6 +197,12 @@ struct elk_conv_wino_trans_output<float,OutputType, BiasType, format,
         p2 = _mm<V>::max_ps(p2, z);
         p3 = _mm<V>::max_ps(p3, z);
       }
+      if (fuse_post_ops) {
+        p0 = post_ops_apply<V>(ep, p0, oc);
+        p1 = post_ops_apply<V>(ep, p1, oc);
+        p2 = post_ops_apply<V>(ep, p2, oc);
+        p3 = post_ops_apply<V>(ep, p3, oc);
+      }
       STORE(i, 0)
       STORE(i, 1)
       STORE(i, 2)
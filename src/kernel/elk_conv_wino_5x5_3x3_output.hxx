@@ -4,6 +4,7 @@
 #include "elk_def.hpp"
 #include "el_utils.hpp"
 #include "elk_conv_wino.hpp"
+#include "elx_post_ops.hpp"
 
 namespace euler {
 #undef FUSE_BIAS
@@ -44,41 +45,51 @@ namespace euler {
   __m<V> p0##n = c0 + c1 + c2 + c3 + c4 + c5;                                  \
   if (fuse_bias) {FUSE_BIAS(p0##n)}                                            \
   if (fuse_ip_sum)                                                             \
-    p0##n = p0##n + *(__m<V>*)out_ptr(0, n);                                   \
+    p0##n = _mm<V>::fmadd_ps(*(__m<V> *)out_ptr(0, n), msum, p0##n);           \
   if (fuse_relu) {                                                             \
     zero = _mm<V>::xor_ps(zero, zero);                                         \
     p0##n = _mm<V>::max_ps(p0##n, zero);                                       \
   }                                                                            \
+  if (fuse_post_ops)                                                           \
+    p0##n = post_ops_apply<V>(ep, p0##n, oc);                                  \
   STORE(0, n)                                                                  \
   __m<V> p1##n = (z2 * (c2 - c3) + c0) + (z1_2 * (c4 - c5) - c1);              \
   if (fuse_bias) {FUSE_BIAS(p1##n)}                                            \
   if (fuse_ip_sum)                                                             \
-    p1##n = (p1##n + *(__m<V>*)out_ptr(1, n));                                 \
+    p1##n = _mm<V>::fmadd_ps(*(__m<V> *)out_ptr(1, n), msum, p1##n);           \
   if (fuse_relu)                                                               \
     p1##n = _mm<V>::max_ps(p1##n, zero);                                       \
+  if (fuse_post_ops)                                                           \
+    p1##n = post_ops_apply<V>(ep, p1##n, oc);                                  \
   STORE(1, n)                                                                  \
   __m<V> p2##n = (z4 * (c2 + c3) + c0) + (z1_4 * (c4 + c5) + c1);              \
   if (fuse_bias) {FUSE_BIAS(p2##n)}                                            \
   if (fuse_ip_sum)                                                             \
-    p2##n = p2##n + *(__m<V>*)out_ptr(2, n);                                   \
+    p2##n = _mm<V>::fmadd_ps(*(__m<V> *)out_ptr(2, n), msum, p2##n);           \
   if (fuse_relu)                                                               \
     p2##n = _mm<V>::max_ps(p2##n, zero);                                       \
+  if (fuse_post_ops)                                                           \
+    p2##n = post_ops_apply<V>(ep, p2##n, oc);                                  \
   STORE(2, n)                                                                  \
   __m<V> p3##n = (z8 * (c2 - c3) + c0) + (z1_8 * (c4 - c5) - c1);              \
   if (fuse_bias) {FUSE_BIAS(p3##n)}                                            \
   if (fuse_ip_sum)                                                             \
-    p3##n = p3##n + *(__m<V>*)out_ptr(3, n);                                   \
+    p3##n = _mm<V>::fmadd_ps(*(__m<V> *)out_ptr(3, n), msum, p3##n);           \
   if (fuse_relu)                                                               \
     p3##n = _mm<V>::max_ps(p3##n, zero);                                       \
+  if (fuse_post_ops)                                                           \
+    p3##n = post_ops_apply<V>(ep, p3##n, oc);                                  \
   STORE(3, n)                                                                  \
   __m<V> p4##n = (z16 * (c2 + c3) + c0) + (z1_16 * (c4 + c5) + c1);
 
 #define AVX512_ADD_B(n);                                                       \
   if (fuse_bias) {FUSE_BIAS(p4##n)}                                            \
   if (fuse_ip_sum)                                                             \
-    p4##n = p4##n + *(__m<V>*)out_ptr(4, n);                                   \
+    p4##n = _mm<V>::fmadd_ps(*(__m<V> *)out_ptr(4, n), msum, p4##n);           \
   if (fuse_relu)                                                               \
     p4##n = _mm<V>::max_ps(p4##n, zero);                                       \
+  if (fuse_post_ops)                                                           \
+    p4##n = post_ops_apply<V>(ep, p4##n, oc);                                  \
   STORE(4, n)
 
 template <typename OutputType, typename BiasType,
@@ -90,12 +101,15 @@ struct elk_conv_wino_trans_output<float, OutputType, BiasType, format,
   constexpr static int K = 3;
 
   static void execute(elx_param_t &ep, OutputType *output,
-      float *toutput, BiasType *bias, int hOA_end, int wOA_end)
+      float *toutput, BiasType *bias, int hOA_end, int wOA_end,
+      int attr, int oc)
   {
     ENABLE_AVX512F();
     bool fuse_ip_sum = with_ip_sum && (wOA_end != -1);
     bool fuse_bias = with_bias && (bias != nullptr);
     bool fuse_relu = with_relu && (bias != nullptr);
+    bool fuse_post_ops = test_bit(attr, AT_POST_OPS_MASK);
+    __m<V> msum = _mm<V>::set1_ps(ep.sum_scale_fused ? ep.sum_scale : 1.f);
 
     MD3(float, atoutput, toutput, A, A, V);
     alignas(64) OutputType dummy[16];
@@ -0,0 +1,119 @@
+#pragma once
+#include <x86intrin.h>
+#include "el_intrin.hpp"
+#include "elk_def.hpp"
+#include "el_utils.hpp"
+#include "elk_conv_wino.hpp"
+#include "elk_conv_wino_matrices.hpp"
+
+namespace euler {
+
+// Input transform BT * d * B of tile sizes without a hand written kernel,
+// by elk_conv_wino_input_matrix<A>
+template <typename InputType, int format, bool is_border, int A, int V>
+struct elk_conv_wino_trans_input<float, InputType, format, is_border,
+    ISA_AVX512, A, V> {
+  using matrix = elk_conv_wino_input_matrix<A>;
+
+  static void execute(elx_param_t &ep, float *tinput,
+      InputType *input, int hA_start, int hA_end, int wA_start, int wA_end) {
+    ENABLE_AVX512F();
+
+    MD3(float, atinput, tinput, A, A, V);
+
+#undef ldr_f32_impl
+#undef ldr_f16_impl
+#undef ldr_u8_impl
+
+#define ldr_f32_impl(addr) \
+  ({ \
+    _mm<V>::load_ps(addr); \
+  })
+
+#define ldr_f16_impl(addr) \
+  ({ \
+    __m256i f16 = _mm<V / 2>::load_si256((__m256i *)addr); \
+    _mm<V>::cvtph_ps(f16); \
+  })
+
+#define ldr_u8_impl(addr) \
+  ({ \
+    __i<V> isrcu8 = _mm512_cvtepu8_epi32(*(__m128i *)addr); \
+    _mm512_cvt_roundepi32_ps(isrcu8, \
+        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); \
+  })
+
+    auto readin = [&](int _h, int _w) {
+      if (format == TKF_COMPACT) {
+        MD3(InputType, ainput, input, A, A, V);
+        if (std::is_same<InputType, float>::value) {
+          return ldr_f32_impl(&md3(ainput, _h, _w, 0));
+        } else if (std::is_same<InputType, uint8_t>::value) {
+          return ldr_u8_impl(&md3(ainput, _h, _w, 0));
+        } else {
+          return ldr_f16_impl(&md3(ainput, _h, _w, 0));
+        }
+      } else if (format == TKF_BLOCKED) {
+        MD3(InputType, ainput, input, ep.ih, ep.iw, V);
+        if (is_border
+            && (_h < hA_start || _w < wA_start || _h > hA_end || _w > wA_end)) {
+          return _mm<V>::setzero_ps();
+        } else if (std::is_same<InputType, float>::value) {
+          return ldr_f32_impl(&md3(ainput, _h, _w, 0));
+        } else if (std::is_same<InputType, uint8_t>::value) {
+          return ldr_u8_impl(&md3(ainput, _h, _w, 0));
+        } else {
+          return ldr_f16_impl(&md3(ainput, _h, _w, 0));
+        }
+      } else { // TKF_NHWC
+        MD3(InputType, ainput0, input, ep.ih, ep.iw, ep.ic);
+        MD2(InputType, ainput1, &md3(ainput0, _h, _w, 0),
+            ep.I4 * ep.I3 * ep.I2, V);
+        if (is_border
+            && (_h < hA_start || _w < wA_start || _h > hA_end || _w > wA_end)) {
+          return _mm<V>::setzero_ps();
+        } else if (std::is_same<InputType, float>::value) {
+          return ldr_f32_impl(&md2(ainput1, 0, 0));
+        } else if (std::is_same<InputType, uint8_t>::value) {
+          return ldr_u8_impl(&md2(ainput1, 0, 0));
+        } else {
+          return ldr_f16_impl(&md2(ainput1, 0, 0));
+        }
+      }
+    };
+
+    // Row k of BT over f[0..A), zero coefficients skipped
+    auto dot = [&](int k, const __m<V> *f) {
+      __m<V> acc = _mm<V>::setzero_ps();
+#pragma unroll
+      for (int j = 0; j < A; j++) {
+        float c = matrix::BT(k, j);
+        if (c != 0.0f)
+          acc = _mm<V>::fmadd_ps(f[j], _mm<V>::set1_ps(c), acc);
+      }
+      return acc;
+    };
+
+    __m<V> M[A][A];
+
+#pragma unroll
+    for (int i = 0; i < A; i++) {
+      __m<V> f[A];
+#pragma unroll
+      for (int j = 0; j < A; j++)
+        f[j] = readin(j, i);
+#pragma unroll
+      for (int k = 0; k < A; k++)
+        M[k][i] = dot(k, f);
+    }
+
+#pragma unroll
+    for (int i = 0; i < A; i++) {
+#pragma unroll
+      for (int k = 0; k < A; k++)
+        *(__m<V> *)(&md3(atinput, i, k, 0)) = dot(k, M[i]);
+    }
+  }
+}; // elk_conv_wino_trans_input
+
+} // namespace euler
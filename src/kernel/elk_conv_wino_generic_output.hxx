@@ -0,0 +1,143 @@
+#pragma once
+#include <x86intrin.h>
+#include "el_intrin.hpp"
+#include "elk_def.hpp"
+#include "el_utils.hpp"
+#include "elk_conv_wino.hpp"
+#include "elx_post_ops.hpp"
+#include "elk_conv_wino_matrices.hpp"
+
+namespace euler {
+
+// Output transform AT * m * A of F(A - K + 1, K) without a hand written
+// kernel, by elk_conv_wino_matrices<A, K>
+template <typename OutputType, typename BiasType,
+    int format, bool is_border, bool with_bias, bool with_relu,
+    bool with_ip_sum, int A, int K, int V>
+struct elk_conv_wino_trans_output<float, OutputType, BiasType, format,
+    is_border, with_bias, with_relu, with_ip_sum, ISA_AVX512, A, K, V> {
+  using matrix = elk_conv_wino_matrices<A, K>;
+  constexpr static int m = A - K + 1;
+
+  static void execute(elx_param_t &ep, OutputType *output,
+      float *toutput, BiasType *bias, int hOA_end, int wOA_end,
+      int attr, int oc)
+  {
+    ENABLE_AVX512F();
+
+    __m<V> mrepS, mzp;
+
+    MD3(float, atoutput, toutput, A, A, V);
+    if (std::is_same<OutputType, uint8_t>::value
+        || std::is_same<OutputType, int8_t>::value) {
+      mrepS = _mm<V>::set1_ps(ep.output_quant_repS);
+      mzp = _mm<V>::set1_ps(ep.output_quant_z);
+    }
+
+    bool fuse_ip_sum = with_ip_sum && (wOA_end != -1);
+    bool fuse_bias = with_bias && (bias != nullptr);
+    bool fuse_relu = with_relu && (bias != nullptr);
+    bool fuse_post_ops = test_bit(attr, AT_POST_OPS_MASK);
+    __m<V> msum = _mm<V>::set1_ps(ep.sum_scale_fused ? ep.sum_scale : 1.f);
+
+    alignas(64) OutputType dummy[V];
+    auto out_ptr = [&](int _h, int _w) {
+      if (format == TKF_COMPACT) {
+        MD3(OutputType, aoutput, output, m, m, V);
+        return &md3(aoutput, _h, _w, 0);
+      } else if (format == TKF_BLOCKED) {
+        MD3(OutputType, aoutput, output, ep.oh, ep.ow, V);
+        if (is_border && (_h > hOA_end || _w > wOA_end))
+          return dummy;
+        else
+          return &md3(aoutput, _h, _w, 0);
+      } else {
+        MD3(OutputType, aoutput, output, ep.oh, ep.ow, ep.oc);
+        if (is_border && (_h > hOA_end || _w > wOA_end))
+          return dummy;
+        else
+          return &md3(aoutput, _h, _w, 0);
+      }
+    };
+
+    auto load_out = [&](OutputType *p) {
+      if (std::is_same<OutputType, uint8_t>::value)
+        return _mm<V>::cvtepi32_ps(_mm<V>::cvtepu8_epi32(*(__m128i *)p));
+      else if (std::is_same<OutputType, int8_t>::value)
+        return _mm<V>::cvtepi32_ps(_mm<V>::cvtepi8_epi32(*(__m128i *)p));
+      else if (std::is_same<OutputType, float>::value)
+        return *(__m<V> *)p;
+      else
+        return _mm<V>::cvtph_ps(_mm<V / 2>::load_si256((__m256i *)p));
+    };
+
+    auto store_out = [&](OutputType *p, __m<V> x) {
+      if (std::is_same<OutputType, float>::value) {
+        _mm<V>::store_ps(p, x);
+      } else if (std::is_same<OutputType, uint8_t>::value) {
+        __i<V> mresu32 = _mm<V>::cvt_roundps_epu32(
+            x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_store_si128((__m128i *)p, _mm<V>::cvtusepi32_epi8(mresu32));
+      } else if (std::is_same<OutputType, int8_t>::value) {
+        __i<V> mresi32 = _mm<V>::cvt_roundps_epi32(
+            x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_store_si128((__m128i *)p, _mm<V>::cvtsepi32_epi8(mresi32));
+      } else {
+        auto f16 = _mm<V>::cvtps_ph(
+            x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm<V / 2>::store_si256((__m256i *)p, f16);
+      }
+    };
+
+    // Row k of AT over f[0..A), zero coefficients skipped
+    auto dot = [&](int k, const __m<V> *f) {
+      __m<V> acc = _mm<V>::setzero_ps();
+#pragma unroll
+      for (int j = 0; j < A; j++) {
+        float c = matrix::AT(k, j);
+        if (c != 0.0f)
+          acc = _mm<V>::fmadd_ps(f[j], _mm<V>::set1_ps(c), acc);
+      }
+      return acc;
+    };
+
+    __m<V> M[m][A];
+    __m<V> z = _mm<V>::setzero_ps();
+
+#pragma unroll
+    for (int i = 0; i < A; i++) {
+      __m<V> f[A];
+#pragma unroll
+      for (int j = 0; j < A; j++)
+        f[j] = _mm<V>::load_ps(&md3(atoutput, j, i, 0));
+#pragma unroll
+      for (int k = 0; k < m; k++)
+        M[k][i] = dot(k, f);
+    }
+
+#pragma unroll
+    for (int i = 0; i < m; i++) {
+#pragma unroll
+      for (int j = 0; j < m; j++) {
+        auto p = dot(j, M[i]);
+        if (fuse_bias) {
+          p += std::is_same<BiasType, float>::value
+              ? *(__m<V> *)bias
+              : _mm<V>::cvtph_ps(_mm<V / 2>::load_si256((__m256i *)bias));
+        }
+        if (std::is_same<OutputType, uint8_t>::value
+            || std::is_same<OutputType, int8_t>::value)
+          p = p * mrepS + mzp;
+        if (fuse_ip_sum)
+          p = _mm<V>::fmadd_ps(load_out(out_ptr(i, j)), msum, p);
+        if (fuse_relu)
+          p = _mm<V>::max_ps(p, z);
+        if (fuse_post_ops)
+          p = post_ops_apply<V>(ep, p, oc);
+        store_out(out_ptr(i, j), p);
+      }
+    }
+  }
+}; // elk_conv_wino_trans_output
+
+} // namespace euler
@@ -0,0 +1,64 @@
+#pragma once
+#include <x86intrin.h>
+#include "el_intrin.hpp"
+#include "elk_def.hpp"
+#include "el_utils.hpp"
+#include "elk_conv_wino.hpp"
+#include "elk_conv_wino_matrices.hpp"
+
+namespace euler {
+
+// Weights transform G * g * GT of F(A - K + 1, K) without a hand written
+// kernel, by elk_conv_wino_matrices<A, K>
+template <typename WeightsType, int A, int K, int V>
+struct elk_conv_wino_trans_weights<float, WeightsType, ISA_AVX512,
+    A, K, V> {
+  using matrix = elk_conv_wino_matrices<A, K>;
+
+  static void execute(
+      float atweights[A][A][V][V], WeightsType aweights[K][K][V][V])
+  {
+    ENABLE_AVX512F();
+
+    // Row k of G over f[0..K), zero coefficients skipped
+    auto dot = [&](int k, const __m<V> *f) {
+      __m<V> acc = _mm<V>::setzero_ps();
+#pragma unroll
+      for (int j = 0; j < K; j++) {
+        float c = matrix::G(k, j);
+        if (c != 0.0f)
+          acc = _mm<V>::fmadd_ps(f[j], _mm<V>::set1_ps(c), acc);
+      }
+      return acc;
+    };
+
+    __m<V> M[A][K];
+
+    for (int _V = 0; _V < V; ++_V) {
+#pragma unroll
+      for (int i = 0; i < K; i++) {
+        __m<V> f[K];
+#pragma unroll
+        for (int j = 0; j < K; j++) {
+          if (std::is_same<WeightsType, float>::value)
+            f[j] = _mm<V>::load_ps(aweights[j][i][_V]);
+          else
+            f[j] = _mm<V>::cvtph_ps(
+                _mm<V / 2>::load_si256((__m256i *)aweights[j][i][_V]));
+        }
+#pragma unroll
+        for (int k = 0; k < A; k++)
+          M[k][i] = dot(k, f);
+      }
+
+#pragma unroll
+      for (int i = 0; i < A; i++) {
+#pragma unroll
+        for (int k = 0; k < A; k++)
+          *(__m<V> *)atweights[i][k][_V] = dot(k, M[i]);
+      }
+    }
+  }
+}; // elk_conv_wino_trans_weights
+
+} // namespace euler
@@ -0,0 +1,151 @@
+#pragma once
+
+namespace euler {
+
+// Cook-Toom transform matrices of Winograd F(m, K), A = m + K - 1
+//
+// Y = AT * ((G * g * GT) .* (BT * d * B)) * A. BT depends on A only (the
+// interpolation points), G and AT on A and K. The table driven kernels in
+// elk_conv_wino_generic_*.hxx apply them to (A, K) without a hand written
+// kernel.
+//
+// A = 6 points: 0, +-5/8, +-3/2, inf, the input transform of
+//   elk_conv_wino_4x4_3x3_input.hxx
+// A = 8 points: 0, +-1/2, +-1, +-2, inf, the lowest fp32 error of the
+//   candidate sets measured on F(6,3), F(4,5) and F(2,7)
+template <int A> struct elk_conv_wino_input_matrix;
+template <int A, int K> struct elk_conv_wino_matrices;
+
+template <> struct elk_conv_wino_input_matrix<8> {
+  static inline float BT(int i, int j) {
+    static const float m[8][8] = {
+      { 1.0f, 0.0f, -5.25f, 0.0f, 5.25f, 0.0f, -1.0f, 0.0f },
+      { 0.0f, 2.0f, 4.0f, -2.5f, -5.0f, 0.5f, 1.0f, 0.0f },
+      { 0.0f, -2.0f, 4.0f, 2.5f, -5.0f, -0.5f, 1.0f, 0.0f },
+      { 0.0f, 1.0f, 1.0f, -4.25f, -4.25f, 1.0f, 1.0f, 0.0f },
+      { 0.0f, -1.0f, 1.0f, 4.25f, -4.25f, -1.0f, 1.0f, 0.0f },
+      { 0.0f, 0.5f, 0.25f, -2.5f, -1.25f, 2.0f, 1.0f, 0.0f },
+      { 0.0f, -0.5f, 0.25f, 2.5f, -1.25f, -2.0f, 1.0f, 0.0f },
+      { 0.0f, -1.0f, 0.0f, 5.25f, 0.0f, -5.25f, 0.0f, 1.0f }
+    };
+    return m[i][j];
+  }
+};
+
+// F(6,3)
+template <> struct elk_conv_wino_matrices<8, 3> {
+  static inline float G(int i, int j) {
+    static const float m[8][3] = {
+      { 1.0f, 0.0f, 0.0f },
+      { 0.711111111f, 0.355555556f, 0.177777778f },
+      { 0.711111111f, -0.355555556f, 0.177777778f },
+      { -0.222222222f, -0.222222222f, -0.222222222f },
+      { -0.222222222f, 0.222222222f, -0.222222222f },
+      { 0.0111111111f, 0.0222222222f, 0.0444444444f },
+      { 0.0111111111f, -0.0222222222f, 0.0444444444f },
+      { 0.0f, 0.0f, 1.0f }
+    };
+    return m[i][j];
+  }
+  static inline float AT(int i, int j) {
+    static const float m[6][8] = {
+      { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f },
+      { 0.0f, 0.5f, -0.5f, 1.0f, -1.0f, 2.0f, -2.0f, 0.0f },
+      { 0.0f, 0.25f, 0.25f, 1.0f, 1.0f, 4.0f, 4.0f, 0.0f },
+      { 0.0f, 0.125f, -0.125f, 1.0f, -1.0f, 8.0f, -8.0f, 0.0f },
+      { 0.0f, 0.0625f, 0.0625f, 1.0f, 1.0f, 16.0f, 16.0f, 0.0f },
+      { 0.0f, 0.03125f, -0.03125f, 1.0f, -1.0f, 32.0f, -32.0f, 1.0f }
+    };
+    return m[i][j];
+  }
+};
+
+// F(2,5)
+template <> struct elk_conv_wino_matrices<6, 5> {
+  static inline float G(int i, int j) {
+    static const float m[6][5] = {
+      { 1.13777778f, 0.0f, 0.0f, 0.0f, 0.0f },
+      { -0.688403361f, -0.430252101f, -0.268907563f, -0.168067227f,
+        -0.105042017f },
+      { -0.688403361f, 0.430252101f, -0.268907563f, 0.168067227f,
+        -0.105042017f },
+      { 0.119514472f, 0.179271709f, 0.268907563f, 0.403361345f,
+        0.605042017f },
+      { 0.119514472f, -0.179271709f, 0.268907563f, -0.403361345f,
+        0.605042017f },
+      { 0.0f, 0.0f, 0.0f, 0.0f, 1.0f }
+    };
+    return m[i][j];
+  }
+  static inline float AT(int i, int j) {
+    static const float m[2][6] = {
+      { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f },
+      { 0.0f, 0.625f, -0.625f, 1.5f, -1.5f, 1.0f }
+    };
+    return m[i][j];
+  }
+};
+
+// F(4,5)
+template <> struct elk_conv_wino_matrices<8, 5> {
+  static inline float G(int i, int j) {
+    static const float m[8][5] = {
+      { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+      { 0.711111111f, 0.355555556f, 0.177777778f, 0.0888888889f,
+        0.0444444444f },
+      { 0.711111111f, -0.355555556f, 0.177777778f, -0.0888888889f,
+        0.0444444444f },
+      { -0.222222222f, -0.222222222f, -0.222222222f, -0.222222222f,
+        -0.222222222f },
+      { -0.222222222f, 0.222222222f, -0.222222222f, 0.222222222f,
+        -0.222222222f },
+      { 0.0111111111f, 0.0222222222f, 0.0444444444f, 0.0888888889f,
+        0.177777778f },
+      { 0.0111111111f, -0.0222222222f, 0.0444444444f, -0.0888888889f,
+        0.177777778f },
+      { 0.0f, 0.0f, 0.0f, 0.0f, 1.0f }
+    };
+    return m[i][j];
+  }
+  static inline float AT(int i, int j) {
+    static const float m[4][8] = {
+      { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f },
+      { 0.0f, 0.5f, -0.5f, 1.0f, -1.0f, 2.0f, -2.0f, 0.0f },
+      { 0.0f, 0.25f, 0.25f, 1.0f, 1.0f, 4.0f, 4.0f, 0.0f },
+      { 0.0f, 0.125f, -0.125f, 1.0f, -1.0f, 8.0f, -8.0f, 1.0f }
+    };
+    return m[i][j];
+  }
+};
+
+// F(2,7)
+template <> struct elk_conv_wino_matrices<8, 7> {
+  static inline float G(int i, int j) {
+    static const float m[8][7] = {
+      { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+      { 0.711111111f, 0.355555556f, 0.177777778f, 0.0888888889f,
+        0.0444444444f, 0.0222222222f, 0.0111111111f },
+      { 0.711111111f, -0.355555556f, 0.177777778f, -0.0888888889f,
+        0.0444444444f, -0.0222222222f, 0.0111111111f },
+      { -0.222222222f, -0.222222222f, -0.222222222f, -0.222222222f,
+        -0.222222222f, -0.222222222f, -0.222222222f },
+      { -0.222222222f, 0.222222222f, -0.222222222f, 0.222222222f,
+        -0.222222222f, 0.222222222f, -0.222222222f },
+      { 0.0111111111f, 0.0222222222f, 0.0444444444f, 0.0888888889f,
+        0.177777778f, 0.355555556f, 0.711111111f },
+      { 0.0111111111f, -0.0222222222f, 0.0444444444f, -0.0888888889f,
+        0.177777778f, -0.355555556f, 0.711111111f },
+      { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f }
+    };
+    return m[i][j];
+  }
+  static inline float AT(int i, int j) {
+    static const float m[2][8] = {
+      { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f },
+      { 0.0f, 0.5f, -0.5f, 1.0f, -1.0f, 2.0f, -2.0f, 1.0f }
+    };
+    return m[i][j];
+  }
+};
+
+} // namespace euler
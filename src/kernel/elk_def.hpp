@@ -64,6 +64,12 @@ const int GKP_S_MASK = ((0x1 << 7) - 1);
 
 const int S2_LLP = 2 | GKP_LLP_MASK;
 
+// Kernel table bounds (elk_gemm_gen.sh, elk_conv_gen.sh):
+// gemm: max T for O = 1..8; conv: O = 1..2, T = 1..14
+const int kgemm_max_T[] = { 31, 14, 14, 14, 5, 4, 3, 8 };
+const int kconv_max_O = 2;
+const int kconv_max_T = 14;
+
 }  // namespace euler
 
 #endif // __ELK_DEF_HPP__
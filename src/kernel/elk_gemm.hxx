@@ -4,6 +4,7 @@
 #include "el_utils.hpp"
 #include "el_stl.hpp"
 #include "elx_conv.hpp"
+#include "elx_post_ops.hpp"
 #include "elk_gemm_traits.hxx"
 
 // S: stride
@@ -233,6 +234,8 @@ struct gemm_kernel<GarrayTypes, V, Vx, ISA_AVX512,
       res = _mm<V>::max_ps(res, lower);
       res = _mm<V>::min_ps(res, upper);
     }
+    if (test_bit(attr, AT_POST_OPS_MASK))
+      res = post_ops_apply<V>(ep, res);
     if (test_bit(attr, AT_STREAMING_OUTPUT_MASK)) {
       if (std::is_same<OutputType, float>::value) {
         _mm<V>::stream_ps(aout, res);
@@ -275,6 +278,8 @@ struct gemm_kernel<GarrayTypes, V, Vx, ISA_AVX512,
       res = _mm<V>::max_ps(res, lower);
       res = _mm<V>::min_ps(res, upper);
     }
+    if (test_bit(attr, AT_POST_OPS_MASK))
+      res = post_ops_apply<V>(ep, res);
     if (std::is_same<OutputType, float>::value) {
       _mm512_mask_store_ps(aout, k, res);
     } else {
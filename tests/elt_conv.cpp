@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <float.h>
+#include <math.h>
 #include <string>
 #include <string.h>
 #include <sstream>
@@ -9,6 +10,7 @@
 #include "elt_conv_utils.hpp"
 #include "euler.hpp"
 #include <iostream>
+#include <thread>
 #include <unordered_map>
 #include "elt_gflag.hpp"
 
@@ -21,7 +23,12 @@ bool verbose = false;
 int mb = 0, g = 1, ic = 0, ih = 0, iw = 0, oc = 0, oh = 0, ow = 0, kh = 3, kw = 3;
 int ph = 1, pw = 1, sh = 1, sw = 1, dh = 1, dw = 1;
 bool with_bias = true, with_relu = false, with_ip_sum = false,
-     with_argmax = false, f16c_opt = false, disable_autoparam = true;
+     with_argmax = false, f16c_opt = false, disable_autoparam = true,
+     auto_tune = false, arena = false, with_bn = false;
+int stream_producers = 0;
+int arena_inflight = 1;
+std::string chain;
+int band_rows = 0, thread_bands = 0;
 int data_type_cfg = 0;
 int prop_kind = forward_inference, alg = CONV_AUTO;
 int input_format = nChw16c, weights_format = OIhw16i16o,
@@ -32,6 +39,7 @@ int flt_o = 1, flt_t = 1;
 int blk_i = 1, blk_o = 1;
 int pat_i = 1, pat_o = 1, pat_g = 1;
 int tile_size = 0;
+double wino_error_budget = 0.0;
 int streaming_input = 0, streaming_output = 0;
 bool input_as_blocked = false, weights_as_blocked = false,
      output_as_blocked = false;
@@ -50,6 +58,130 @@ float tinput_cali_s = FLT_MAX;
 float tinput_cali_z = FLT_MAX;
 std::string name;
 
+// Post-op list of bias/sum/relu, the --post-ops tail and a pooling op,
+// empty for the fused flags only. Reference list: batch norm as a
+// scale_shift after the bias, no pooling
+std::vector<eld_post_op_t> post_ops, ref_post_ops;
+eld_post_op_t pool_op = {};
+std::vector<float> post_op_scale, post_op_shift;
+std::vector<float> bn_mean, bn_var, bn_gamma, bn_beta, bn_scale, bn_shift;
+float sum_alpha = 1.0f;
+
+// max|avg:k:s:p to pool_op, window k x k, strides s and pads p
+static int parse_pool(const std::string &spec) {
+  if (spec.empty())
+    return 0;
+  std::stringstream fields(spec);
+  std::string kind, k, s, p;
+  std::getline(fields, kind, ':');
+  std::getline(fields, k, ':');
+  std::getline(fields, s, ':');
+  std::getline(fields, p, ':');
+  if ((kind != "max" && kind != "avg") || k.empty()) {
+    printf("Error: convolution options: pool should be max|avg:k[:s[:p]]\n");
+    return -1;
+  }
+  pool_op.kind = kind == "max" ? POST_OP_MAX_POOL : POST_OP_AVG_POOL;
+  pool_op.pool.kh = pool_op.pool.kw = atoi(k.c_str());
+  pool_op.pool.sh = pool_op.pool.sw = s.empty() ? 1 : atoi(s.c_str());
+  pool_op.pool.t = pool_op.pool.l = p.empty() ? 0 : atoi(p.c_str());
+  return 0;
+}
+
+// kind[:alpha[:beta]],... after bias/sum/relu to post_ops
+static int parse_post_ops(const std::string &spec) {
+  std::unordered_map<std::string, int> kinds{
+      {"relu", POST_OP_RELU},   {"leaky", POST_OP_LEAKY_RELU},
+      {"elu", POST_OP_ELU},     {"swish", POST_OP_SWISH},
+      {"gelu", POST_OP_GELU},   {"clip", POST_OP_CLIP},
+      {"scale_shift", POST_OP_SCALE_SHIFT}};
+  auto post_op = [](int kind, float alpha) {
+    eld_post_op_t op = {};
+    op.kind = kind;
+    op.alpha = alpha;
+    return op;
+  };
+
+  bool with_pool = pool_op.pool.kh > 0;
+  bool with_list = !spec.empty() || sum_alpha != 1.0f || with_pool;
+  if (!with_list && !with_bn)
+    return 0;
+  if (with_bias)
+    post_ops.push_back(post_op(POST_OP_BIAS, 0.0f));
+  if (with_ip_sum)
+    post_ops.push_back(post_op(POST_OP_SUM, sum_alpha));
+  if (with_relu)
+    post_ops.push_back(post_op(POST_OP_RELU, 0.0f));
+
+  // Per-channel scale_shift
+  for (auto c = 0; c < oc; ++c) {
+    post_op_scale.push_back(0.5f + 0.125f * (c % 8));
+    post_op_shift.push_back((c % 5) - 2.0f);
+  }
+
+  std::stringstream items(spec);
+  std::string item;
+  while (std::getline(items, item, ',')) {
+    std::stringstream fields(item);
+    std::string kind, alpha, beta;
+    std::getline(fields, kind, ':');
+    std::getline(fields, alpha, ':');
+    std::getline(fields, beta, ':');
+    if (kinds.find(kind) == kinds.end()) {
+      printf("Error: convolution options: post-ops kind should be "
+             "relu|leaky|elu|swish|gelu|clip|scale_shift\n");
+      return -1;
+    }
+    auto op = post_op(kinds[kind], 1.0f);
+    if (!alpha.empty())
+      op.alpha = atof(alpha.c_str());
+    else if (op.kind == POST_OP_LEAKY_RELU)
+      op.alpha = 0.1f;
+    else if (op.kind == POST_OP_CLIP)
+      op.alpha = 0.0f;
+    op.beta = beta.empty() ? 6.0f : atof(beta.c_str());
+    if (op.kind == POST_OP_SCALE_SHIFT) {
+      op.scale = post_op_scale.data();
+      op.shift = post_op_shift.data();
+    }
+    post_ops.push_back(op);
+  }
+
+  ref_post_ops = post_ops;
+  if (with_bn) {
+    const float epsilon = eld_conv_t().batch_norm.epsilon;
+    for (auto c = 0; c < oc; ++c) {
+      bn_mean.push_back((c % 9) - 4.0f);
+      bn_var.push_back(0.5f + (c % 5));
+      bn_gamma.push_back(0.5f + 0.25f * (c % 4));
+      bn_beta.push_back((c % 3) - 1.0f);
+      bn_scale.push_back(bn_gamma[c] / sqrt((double)bn_var[c] + epsilon));
+      bn_shift.push_back(bn_beta[c] - bn_mean[c] * bn_scale[c]);
+    }
+    auto bn = post_op(POST_OP_SCALE_SHIFT, 0.0f);
+    bn.scale = bn_scale.data();
+    bn.shift = bn_shift.data();
+    ref_post_ops.insert(ref_post_ops.begin() + (with_bias ? 1 : 0), bn);
+  }
+  if (!with_list)
+    post_ops.clear();
+  if (with_pool)
+    post_ops.push_back(pool_op);
+  return 0;
+}
+
+// Post-ops and batch norm of the tested descs
+static inline void create_post_ops(eld_conv_t &desc) {
+  desc.post_ops = post_ops;
+  desc.with_batch_norm = with_bn;
+  if (with_bn) {
+    desc.batch_norm.mean = bn_mean.data();
+    desc.batch_norm.var = bn_var.data();
+    desc.batch_norm.gamma = bn_gamma.data();
+    desc.batch_norm.beta = bn_beta.data();
+  }
+}
+
 int parse_cmd_options(int argc, char **argv) {
 
   gflags_namespace::SetUsageMessage("Euler convolution benchmark test");
@@ -80,6 +212,7 @@ int parse_cmd_options(int argc, char **argv) {
   double_buffering = FLAGS_dbuffering;
   output_as_input = FLAGS_output_as_input;
   tile_size = FLAGS_tile_size;
+  wino_error_budget = FLAGS_wino_error_budget;
   nthreads = FLAGS_nthreads;
   flt_o = FLAGS_flt_o;
   flt_t = FLAGS_flt_t;
@@ -99,6 +232,15 @@ int parse_cmd_options(int argc, char **argv) {
   tinput_cali_s = FLAGS_tinput_cali_s;
   tinput_cali_z = FLAGS_tinput_cali_z;
   disable_autoparam = FLAGS_disable_autoparam;
+  auto_tune = FLAGS_auto_tune;
+  arena = FLAGS_arena;
+  arena_inflight = FLAGS_arena_inflight;
+  stream_producers = FLAGS_stream_producers;
+  sum_alpha = FLAGS_sum_alpha;
+  with_bn = FLAGS_with_bn;
+  chain = FLAGS_chain;
+  band_rows = FLAGS_band_rows;
+  thread_bands = FLAGS_thread_bands;
   name = FLAGS_name;
 
   std::transform(FLAGS_alg.begin(), FLAGS_alg.end(), FLAGS_alg.begin(),
@@ -222,6 +364,32 @@ int parse_cmd_options(int argc, char **argv) {
   iw = iw == 0 ? ih : iw;
   ow = ow == 0 ? oh : ow;
 
+  if (parse_pool(FLAGS_pool) || parse_post_ops(FLAGS_post_ops))
+    return -1;
+
+  if (!chain.empty()) {
+    if (chain != "1x1" && chain != "dw") {
+      printf("Error: convolution options: chain should be 1x1|dw\n");
+      return -1;
+    }
+    if (input_format != output_format) {
+      printf("Error: convolution options: chain needs input-format equal "
+             "to output-format\n");
+      return -1;
+    }
+    if (data_type_cfg != euler::test::FP32 &&
+        data_type_cfg != euler::test::U8F32U8F32) {
+      printf("Error: convolution options: chain supports FP32 and "
+             "U8F32U8F32 only\n");
+      return -1;
+    }
+    if (chain == "dw" && data_type_cfg != euler::test::U8F32U8F32) {
+      printf("Error: convolution options: dw chain supports U8F32U8F32 "
+             "only\n");
+      return -1;
+    }
+  }
+
   if (verbose) {
     printf("Convolution options:\n"
          "mb:%d, g:%d, ic:%d, ih:%d, iw:%d, oc:%d, oh:%d, ow:%d, kh:%d, kw:%d, "
@@ -320,6 +488,7 @@ static inline eld_conv_t &create_conv_desc(eld_conv_t &desc,
   desc.formats = {input_format, weights_format, output_format};
   desc.pads = {pw, pw, ph, ph};
   desc.strides = {sh, sw};
+  desc.dilations = {dh, dw};
   desc.with_bias = with_bias;
   desc.with_argmax = with_argmax;
   desc.with_ip_sum = with_ip_sum;
@@ -327,6 +496,7 @@ static inline eld_conv_t &create_conv_desc(eld_conv_t &desc,
   desc.f16c_opt = f16c_opt;
   desc.algorithm = alg;
   desc.tile_size = tile_size;
+  desc.wino_error_budget = wino_error_budget;
   desc.prop_kind = prop_kind;
   desc.nthreads = nthreads;
   desc.execution_mode = execution_mode;
@@ -339,6 +509,8 @@ static inline eld_conv_t &create_conv_desc(eld_conv_t &desc,
   desc.sampling_kind = sampling_kind;
   desc.use_scratch_pad = false;
   desc.disable_autoparam = disable_autoparam;
+  desc.auto_tune = auto_tune;
+  desc.eager_mode = stream_producers == 0;
   desc.name = name;
   return desc;
 }
@@ -359,18 +531,10 @@ static inline int conv_ref_setup(eld_conv_t &desc) {
   };
 
   bool fully_setup = false;
+  bool use_scratch_pad = false;
   if (int8_user_interface(data_type_cfg) && desc.algorithm == CONV_WINOGRAD) {
-    size_t t = (desc.dims.oh + desc.tile_size - 3) /
-               (desc.tile_size - 3 + 1) *
-               (desc.dims.ow + desc.tile_size - 3) /
-               (desc.tile_size - 3 + 1) * desc.dims.n;
-    size_t A = desc.tile_size;
-    size_t K = 3;
-    size_t IC = ALIGNUP(desc.dims.ic, 16);
-    size_t tinput_byte_size = A * A * IC * t * sizeof(float);
-
-    memalign64(&desc.scratch_pad, tinput_byte_size);
-    desc.use_scratch_pad = true;
+    // Calibration reads transformed input back from scratch pad
+    use_scratch_pad = true;
     desc.execution_mode = 0xa033;
     fully_setup = true;
   } else if (int8_user_interface(data_type_cfg) &&
@@ -385,7 +549,12 @@ static inline int conv_ref_setup(eld_conv_t &desc) {
     desc.execution_mode = 0xd060;
   }
 
-  return desc.setup(fully_setup);
+  int ret = desc.setup(fully_setup);
+  if (ret == ELD_OK && use_scratch_pad) {
+    memalign64(&desc.scratch_pad, desc.byte_sizes.scratch);
+    desc.use_scratch_pad = true;
+  }
+  return ret;
 }
 
 static inline void conv_execute(eld_conv_t convs[], void **input,
@@ -415,6 +584,51 @@ static inline void conv_execute(eld_conv_t convs[], void **input,
   }
 }
 
+// Stream stress: producers submit rounds of all layers concurrently and
+// wait their events. A lost wakeup shows as a submission not completed
+// in time.
+#define STRESS_ROUNDS 64
+#define STRESS_TIMEOUT_S 60
+static inline void conv_stream_stress(eld_conv_t convs[], void **input,
+                                      void **weights, void **output,
+                                      void **bias, int C) {
+  std::vector<std::thread> producers;
+  std::vector<int> failed(stream_producers, 0);
+  for (auto p = 0; p < stream_producers; ++p) {
+    producers.emplace_back([&, p]() {
+      std::vector<elx_event> events;
+      for (auto r = 0; r < STRESS_ROUNDS; ++r) {
+        for (auto c = 0; c < C; ++c) {
+          elx_event event;
+          if (ELX_OK != elx_conv_async(convs[c], output[c], input[c],
+                                       weights[c], bias[c], {}, event))
+            failed[p] = 1;
+          events.push_back(event);
+        }
+      }
+      auto deadline = std::chrono::steady_clock::now()
+          + std::chrono::seconds(STRESS_TIMEOUT_S);
+      for (auto &e : events) {
+        while (!elx_event_query(e)) {
+          if (std::chrono::steady_clock::now() > deadline) {
+            failed[p] = 1;
+            return;
+          }
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+      }
+    });
+  }
+  for (auto &t : producers)
+    t.join();
+  for (auto p = 0; p < stream_producers; ++p) {
+    if (failed[p])
+      test::error("Fail: Stream submission lost or not completed!\n");
+  }
+  printf("Stream stress: %d producers x %d rounds x %d layers done\n",
+         stream_producers, STRESS_ROUNDS, C);
+}
+
 static inline void conv_bench(eld_conv_t convs[], eld_conv_t &conv_ref,
                               void **input, void **weights, void **output,
                               void **bias, int C) {
@@ -452,11 +666,164 @@ static inline void conv_bench(eld_conv_t convs[], eld_conv_t &conv_ref,
   timer.report_tflops(name, C * (N / C), num_ops);
 }
 
+// Conv chain: layer j of --chain=1x1, 1x1 -> conv -> 1x1, or of
+// --chain=dw, depthwise 3x3 -> conv (MobileNet block). Layer 1 is the
+// convolution of the options. Bias and relu on all layers, sum and
+// post-ops on the last one.
+static inline eld_conv_t &create_chain_desc(eld_conv_t &desc, int j,
+                                            int _data_type_cfg) {
+  bool last = j == (chain == "dw" ? 1 : 2);
+  create_conv_desc(desc, _data_type_cfg);
+  desc.with_ip_sum = last && with_ip_sum;
+  if (last)
+    create_post_ops(desc);
+  if (j == 1)
+    return desc;
+
+  bool depthwise = j == 0 && chain == "dw";
+  int c = j == 0 ? ic : oc, h = j == 0 ? ih : oh, w = j == 0 ? iw : ow;
+  int k = depthwise ? 3 : 1;
+  desc.dims = {mb, depthwise ? c : 1, c, c, h, w, h, w, k, k};
+  desc.pads = {k / 2, k / 2, k / 2, k / 2};
+  desc.strides = {1, 1};
+  desc.dilations = {1, 1};
+  desc.algorithm = depthwise ? CONV_DIRECT : CONV_DIRECT_1X1;
+  if (depthwise) {
+    desc.formats.weights = ghwio;
+    desc.execution_mode = 0xc160;
+  } else {
+    desc.formats.weights = _data_type_cfg == euler::test::FP32
+        ? weights_format : OIhw16i16o;
+    desc.execution_mode = 0;
+  }
+  desc.flatting = {1, 1};
+  desc.blocking = {1, 1};
+  desc.partition = {1, 1, 1};
+  desc.name = name + (j == 0 ? ".0" : ".2");
+  return desc;
+}
+
+template <typename itype, typename wtype, typename otype, typename btype>
+static inline void prepare_chain_data(eld_conv_t &desc_ref, eld_conv_t &desc,
+                                      void **input, void **weights,
+                                      void **output, void **bias) {
+  float *input_ref, *weights_ref, *output_ref, *bias_ref;
+  memalign64(&input_ref, desc_ref.byte_sizes.input);
+  memalign64(&weights_ref, desc_ref.byte_sizes.weights);
+  memalign64(&output_ref, desc_ref.byte_sizes.output);
+  memalign64(&bias_ref, desc_ref.byte_sizes.bias);
+  test::prepare_conv_data<itype, wtype, otype, btype>(
+      desc_ref, desc, input_ref, weights_ref, output_ref, bias_ref,
+      (itype **)input, (wtype **)weights, (otype **)output, (btype **)bias,
+      nullptr, nullptr, nullptr, input_format, desc.formats.weights, false,
+      data_type_cfg, f16c_opt, true);
+  free(input_ref);
+  free(weights_ref);
+  free(output_ref);
+  free(bias_ref);
+}
+
+// Conv chain by elx_conv_chain in bands against layer by layer elx_conv
+// of the same descriptors and data
+#define CHAIN_MAX 3
+static inline int conv_chain_test() {
+  const int K = chain == "dw" ? 2 : 3;
+  eld_conv_t convs[CHAIN_MAX], refs[CHAIN_MAX];
+  eld_conv_t *_convs[CHAIN_MAX];
+  void *input[CHAIN_MAX], *weights[CHAIN_MAX], *output[CHAIN_MAX],
+       *bias[CHAIN_MAX];
+  bool int8 = data_type_cfg == euler::test::U8F32U8F32;
+
+  for (auto j = 0; j < K; ++j) {
+    create_chain_desc(refs[j], j, euler::test::FP32);
+    create_chain_desc(convs[j], j, data_type_cfg);
+    if (refs[j].setup(false) != ELD_OK) {
+      printf("Fail: Convolution setup error!\n");
+      return 0;
+    }
+    if (int8)
+      prepare_chain_data<uint8_t, float, uint8_t, float>(
+          refs[j], convs[j], &input[j], &weights[j], &output[j], &bias[j]);
+    else
+      prepare_chain_data<float, float, float, float>(
+          refs[j], convs[j], &input[j], &weights[j], &output[j], &bias[j]);
+    // Layer input quantized as the previous layer output
+    if (j > 0)
+      convs[j].input_quant = convs[j - 1].output_quant;
+    if (convs[j].setup() != ELD_OK) {
+      printf("Fail: Convolution setup error!\n");
+      return 0;
+    }
+    _convs[j] = &convs[j];
+  }
+
+  eld_conv_chain_t conv_chain;
+  conv_chain.band_rows = band_rows;
+  conv_chain.thread_bands = thread_bands;
+  if (conv_chain.setup(_convs, K) != ELD_OK) {
+    printf("Fail: Conv chain setup error!\n");
+    return 0;
+  }
+  printf("Conv chain: %d layers, bands of %d rows, thread bands %s\n", K,
+         conv_chain.band_rows, conv_chain.thread_bands > 0 ? "on" : "off");
+
+  // Same prior output for the inplace sum of both runs
+  eld_conv_t &last = convs[K - 1];
+  void *chain_output;
+  memalign64(&chain_output, last.byte_sizes.output);
+  memcpy(chain_output, output[K - 1], last.byte_sizes.output);
+
+  for (auto j = 0; j < K; ++j) {
+    if (ELX_OK != elx_conv(convs[j], output[j],
+                           j == 0 ? input[0] : output[j - 1], weights[j],
+                           bias[j]))
+      test::error("Fail: Convolution execution error!\n");
+  }
+  if (ELX_OK != elx_conv_chain(conv_chain, chain_output, input[0], weights,
+                               bias))
+    test::error("Fail: Conv chain execution error!\n");
+
+  printf("Validation: ");
+  eld_conv_t &last_ref = refs[K - 1];
+  if (pool_op.pool.kh > 0) {
+    last_ref.dims.oh = (last_ref.dims.oh + 2 * pool_op.pool.t
+        - pool_op.pool.kh) / pool_op.pool.sh + 1;
+    last_ref.dims.ow = (last_ref.dims.ow + 2 * pool_op.pool.l
+        - pool_op.pool.kw) / pool_op.pool.sw + 1;
+  }
+  float *_output, *_chain_output;
+  memalign64(&_output, last_ref.byte_sizes.output);
+  memalign64(&_chain_output, last_ref.byte_sizes.output);
+  test::post_process_conv_results(_output, last, output[K - 1],
+                                  data_type_cfg);
+  test::post_process_conv_results(_chain_output, last, chain_output,
+                                  data_type_cfg);
+  if (test::compare_conv_results(last_ref, _chain_output, _output,
+                                 data_type_cfg, is_int8_lp, false, true))
+    printf("%s: Fail: Conv chain results not correct!\n", name.c_str());
+  else
+    printf("%s: Conv chain Pass!\n", name.c_str());
+
+  free(_output);
+  free(_chain_output);
+  free(chain_output);
+  for (auto j = 0; j < K; ++j) {
+    free(input[j]);
+    free(weights[j]);
+    free(output[j]);
+    free(bias[j]);
+  }
+  return 0;
+}
+
 #define RL_MAX 128
 int main(int argc, char **argv) {
   if (parse_cmd_options(argc, argv))
     return 0;
 
+  if (!chain.empty())
+    return conv_chain_test();
+
   // 1, create convolution desc
   //    setup convolution
   eld_conv_t convs[RL_MAX];
@@ -467,8 +834,9 @@ int main(int argc, char **argv) {
     return 0;
   }
 
-  const auto C =
-      validate_results ? 1 : repeated_layer <= RL_MAX ? repeated_layer : RL_MAX;
+  // Arena: validated over the repeated layers sharing it
+  const auto C = validate_results && !arena
+      ? 1 : repeated_layer <= RL_MAX ? repeated_layer : RL_MAX;
 
   void *input[RL_MAX], *weights[RL_MAX], *output[RL_MAX], *bias[RL_MAX];
   float *input_ref, *weights_ref, *output_ref, *bias_ref;
@@ -484,6 +852,7 @@ int main(int argc, char **argv) {
   do {                                                                         \
     for (auto c = 0; c < C; ++c) {                                             \
       create_conv_desc(convs[c], data_type_cfg);                               \
+      create_post_ops(convs[c]);                                               \
       input[c] = nullptr;                                                      \
       output[c] = nullptr;                                                     \
       itype **in = (itype **)&input[c];                                        \
@@ -526,8 +895,61 @@ int main(int argc, char **argv) {
     test::error("unsupported UserTypes\n");
   }
 
+  // Scratch/workspace arena shared by all layers
+  eld_conv_arena_t conv_arena;
+  void *arena_scratch = nullptr, *arena_workspace = nullptr;
+  if (arena) {
+    eld_conv_t *_convs[RL_MAX];
+    for (auto c = 0; c < C; ++c)
+      _convs[c] = &convs[c];
+    if (eld_conv_arena_plan(conv_arena, _convs, C, arena_inflight)
+        != ELD_OK)
+      test::error("Fail: Arena plan error!\n");
+    if (conv_arena.scratch_size > 0)
+      memalign64(&arena_scratch, conv_arena.scratch_size);
+    if (conv_arena.workspace_size > 0)
+      memalign64(&arena_workspace, conv_arena.workspace_size);
+    if (eld_conv_arena_bind(conv_arena, _convs, C, arena_scratch,
+                            arena_workspace) != ELD_OK)
+      test::error("Fail: Arena bind error!\n");
+  }
+
+  // Batch norm folds a copy of weights on the first execution: user
+  // weights are kept, later executions run on the folded copy. Arena:
+  // scratch of the other layers must not overlap the workspace a layer
+  // keeps across executions. Either way a second execution gives the
+  // same output.
+  bool rerun = validate_results && (with_bn || arena);
+  eld_conv_t &conv_last = convs[C - 1];
+  void *weights_bn = nullptr, *prior = nullptr;
+  if (with_bn && validate_results) {
+    memalign64(&weights_bn, convs[0].byte_sizes.weights);
+    memcpy(weights_bn, weights[0], convs[0].byte_sizes.weights);
+  }
+  if (rerun) {
+    memalign64(&prior, conv_last.byte_sizes.output);
+    memcpy(prior, output[C - 1], conv_last.byte_sizes.output);
+  }
+
   // 2. execute convolution
-  conv_execute(convs, input, weights, output, bias, C);
+  if (stream_producers > 0)
+    conv_stream_stress(convs, input, weights, output, bias, C);
+  else
+    conv_execute(convs, input, weights, output, bias, C);
+
+  if (with_bn && validate_results &&
+      memcmp(weights_bn, weights[0], convs[0].byte_sizes.weights))
+    printf("%s: Fail: Batch norm changed user weights!\n", name.c_str());
+  if (rerun) {
+    void *first;
+    memalign64(&first, conv_last.byte_sizes.output);
+    memcpy(first, output[C - 1], conv_last.byte_sizes.output);
+    memcpy(output[C - 1], prior, conv_last.byte_sizes.output);
+    conv_execute(convs, input, weights, output, bias, C);
+    if (memcmp(first, output[C - 1], conv_last.byte_sizes.output))
+      printf("%s: Fail: Second execution differs!\n", name.c_str());
+    free(first);
+  }
 
   if (validate_results) {
     // 3. validate results
@@ -536,23 +958,61 @@ int main(int argc, char **argv) {
 
     printf("Validation: ");
 
+    // Post-ops: convolution without sum and relu, then the list over it
+    float *prior_ref = nullptr;
+    bool ref_with_ip_sum = conv_ref.with_ip_sum;
+    bool ref_with_relu = conv_ref.with_relu;
+    if (!ref_post_ops.empty()) {
+      memalign64(&prior_ref, conv_ref.byte_sizes.output);
+      memcpy(prior_ref, output_ref, conv_ref.byte_sizes.output);
+      conv_ref.with_ip_sum = false;
+      conv_ref.with_relu = false;
+    }
+
     if (test::ref_conv_deconv_2d<float>(conv_ref, output_ref, input_ref,
                                         weights_ref, bias_ref)) {
       printf("Fail: Convolution ref execution error!\n");
     } else {
+      if (!ref_post_ops.empty()) {
+        test::ref_post_ops(conv_ref, output_ref, prior_ref, ref_post_ops);
+        conv_ref.with_ip_sum = ref_with_ip_sum;
+        conv_ref.with_relu = ref_with_relu;
+      }
+      // Pooling: pooled reference, compared in pooled dims
+      auto dims_ref = conv_ref.dims;
+      auto sizes_ref = conv_ref.sizes;
+      if (pool_op.pool.kh > 0) {
+        float *pooled_ref;
+        memalign64(&pooled_ref, conv_val.byte_sizes.output);
+        test::ref_pool(conv_ref, pooled_ref, output_ref, pool_op);
+        memcpy(output_ref, pooled_ref, conv_val.byte_sizes.output);
+        free(pooled_ref);
+        conv_ref.dims.oh = (dims_ref.oh + 2 * pool_op.pool.t
+            - pool_op.pool.kh) / pool_op.pool.sh + 1;
+        conv_ref.dims.ow = (dims_ref.ow + 2 * pool_op.pool.l
+            - pool_op.pool.kw) / pool_op.pool.sw + 1;
+        conv_ref.sizes.output = conv_val.sizes.output;
+      }
       float *_output;
       memalign64(&_output, conv_ref.byte_sizes.output);
+      // Error bound of the executed tile size
+      conv_ref.tile_size = conv_val.tile_size;
+      conv_ref.f16c_opt = conv_val.f16c_opt;
       test::post_process_conv_results(_output, conv_val, output_val,
                                       data_type_cfg);
 
       if (test::compare_conv_results(conv_ref, _output, output_ref,
-                                     data_type_cfg, is_int8_lp, with_real_data))
+                                     data_type_cfg, is_int8_lp, with_real_data,
+                                     !ref_post_ops.empty()))
         printf("%s: Fail: Convolution results not correct!\n", name.c_str());
       else
         printf("%s: Convolution Pass!\n", name.c_str());
       free(_output);
+      conv_ref.dims = dims_ref;
+      conv_ref.sizes = sizes_ref;
     }
-  } else {
+    free(prior_ref);
+  } else if (stream_producers == 0) {
     // 4. bench
     conv_bench(convs, conv_ref, input, weights, output, bias, C);
   }
@@ -568,6 +1028,10 @@ int main(int argc, char **argv) {
     free(output[c]);
     free(bias[c]);
   }
+  free(arena_scratch);
+  free(arena_workspace);
+  free(weights_bn);
+  free(prior);
 
   return 0;
 }
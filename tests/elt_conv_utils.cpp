@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <float.h>
 #include <math.h>
 #include <omp.h>
 #include <memory.h>
@@ -237,12 +238,10 @@ void prepare_conv_data(eld_conv_t &desc_ref, eld_conv_t &desc, float *input_ref,
 
     float *tinput = (float *)desc_ref.scratch_pad;
     float min = tinput[0], max = tinput[0];
-    size_t t = (desc.dims.oh + desc.tile_size - 3) /
-               (desc.tile_size - 3 + 1) *
-               (desc.dims.ow + desc.tile_size - 3) /
-               (desc.tile_size - 3 + 1) * desc.dims.n;
     size_t A = desc.tile_size;
-    size_t K = 3;
+    size_t K = desc.dims.kh;
+    size_t t = (desc.dims.oh + A - K) / (A - K + 1) *
+               (desc.dims.ow + A - K) / (A - K + 1) * desc.dims.n;
     size_t IC = desc.dims.ic;
     size_t tinput_size = A * A * IC * t;
     for (size_t i = 1; i < tinput_size; i++) {
@@ -465,21 +464,81 @@ void prepare_conv_data(eld_conv_t &desc_ref, eld_conv_t &desc, float *input_ref,
 
 int compare_conv_results(eld_conv_t &desc, float *out, float *ref,
                          int data_type_cfg, bool is_int8_lp,
-                         bool with_real_data) {
+                         bool with_real_data, bool abs_bound) {
   double acc = is_int8_lp ? (with_real_data ? 1e-1 : 1e-2) : 1e-5;
+  double abs_acc = 0.0;
+
+  // Winograd: the transforms amplify rounding errors by a factor growing
+  // with the tile size, an output near zero has no meaningful relative
+  // error. Bound the error by the largest output instead.
+  if (desc.algorithm == CONV_WINOGRAD && !is_int8_lp) {
+    abs_acc = wino_error_bound(desc, data_type_cfg)
+        * max_abs_conv_output(desc, ref);
+  }
+
+  // Outputs near zero carrying the rounding error of larger values, e.g.
+  // mapped there by activations: bound it by the largest output as well.
+  if (abs_bound && !is_int8_lp)
+    abs_acc = std::max(abs_acc, 1e-6 * max_abs_conv_output(desc, ref));
 
   if (desc.formats.output == nhwc) {
     acc = desc.with_relu ? 1.0 : acc;
-    return __compare_conv_results_nhwc(desc, out, ref, data_type_cfg, acc);
+    return __compare_conv_results_nhwc(desc, out, ref, data_type_cfg, acc,
+                                       abs_acc);
   } else if (desc.formats.output == nchw) {
-    return __compare_conv_results_nchw(desc, out, ref, data_type_cfg, acc);
+    return __compare_conv_results_nchw(desc, out, ref, data_type_cfg, acc,
+                                       abs_acc);
+  } else {
+    return __compare_conv_results_blocked(desc, out, ref, data_type_cfg, acc,
+                                          abs_acc);
+  }
+}
+
+// Error bound of Winograd tile size A relative to the largest output,
+// doubling per tile size step. Measured max error, fp32: ~3e-7 (A=4) to
+// ~1e-5 (A=8). f16 transformed buffers are rejected at A=8 by setup(),
+// below it their max error is dominated by the f16 transformed output,
+// ~5e-3 (A=4) on large integer inputs.
+double wino_error_bound(eld_conv_t &desc, int data_type_cfg) {
+  int A = std::max(desc.tile_size, 4);
+  double eps = (desc.f16c_opt || data_type_cfg != euler::test::FP32)
+      ? 1e-3 : 1e-6;
+  return eps * (1 << (A - 4));
+}
+
+double max_abs_conv_output(eld_conv_t &desc, float *ref) {
+  const int V = 16;
+  auto dims = desc.dims;
+  double max = 0.0;
+
+  if (desc.formats.output == nchw || desc.formats.output == nhwc) {
+    size_t size = (size_t)dims.n * dims.oc * dims.oh * dims.ow;
+    for (size_t i = 0; i < size; i++)
+      max = std::max(max, (double)fabs(ref[i]));
   } else {
-    return __compare_conv_results_blocked(desc, out, ref, data_type_cfg, acc);
+    int C = ALIGNUP(dims.oc, V) / V;
+    int Or = dims.oc % V ? dims.oc % V : V;
+    MD5(float, aref, ref, dims.n, C, dims.oh, dims.ow, V);
+    iter_each(_n, dims.n) {
+      iter_each(_C, C) {
+        iter_each(_h, dims.oh) {
+          iter_each(_w, dims.ow) {
+            int v = _C == C - 1 ? Or : V;
+            iter_each(_v, v) {
+              max = std::max(max,
+                  (double)fabs(md5(aref, _n, _C, _h, _w, _v)));
+            }
+          }
+        }
+      }
+    }
   }
+  return max;
 }
 
 int __compare_conv_results_blocked(eld_conv_t &desc, float *out, float *ref,
-                                   int data_type_cfg, double acc) {
+                                   int data_type_cfg, double acc,
+                                   double abs_acc) {
   const int V = 16;
   auto dims = desc.dims;
   int C = ALIGNUP(dims.oc, V) / V;
@@ -498,6 +557,8 @@ int __compare_conv_results_blocked(eld_conv_t &desc, float *out, float *ref,
           iter_each(_v, v) {
             auto real = md5(aout, _n, _C, _h, _w, _v);
             double delta = fabs(real - md5(aref, _n, _C, _h, _w, _v));
+            if (delta <= abs_acc)
+              continue;
             if (md5(aref, _n, _C, _h, _w, _v) == 0 || real == 0) {
               if (delta > acc) {
                 if (errors < MAX_PRINT_ERRORS) {
@@ -536,7 +597,8 @@ int __compare_conv_results_blocked(eld_conv_t &desc, float *out, float *ref,
 }
 
 int __compare_conv_results_nchw(eld_conv_t &desc, float *out, float *ref,
-                                int data_type_cfg, double acc) {
+                                int data_type_cfg, double acc,
+                                double abs_acc) {
   auto dims = desc.dims;
   MD4(float, aout, out, dims.n, dims.oc, dims.oh, dims.ow);
   MD4(float, aref, ref, dims.n, dims.oc, dims.oh, dims.ow);
@@ -549,6 +611,8 @@ int __compare_conv_results_nchw(eld_conv_t &desc, float *out, float *ref,
         iter_each(_w, dims.ow) {
           auto real = md4(aout, _n, _c, _h, _w);
           double delta = fabs(real - md4(aref, _n, _c, _h, _w));
+          if (delta <= abs_acc)
+            continue;
           if (real == 0 || md4(aref, _n, _c, _h, _w) == 0) {
             if (delta > acc) {
               if (errors < MAX_PRINT_ERRORS) {
@@ -586,7 +650,8 @@ int __compare_conv_results_nchw(eld_conv_t &desc, float *out, float *ref,
 }
 
 int __compare_conv_results_nhwc(eld_conv_t &desc, float *out, float *ref,
-                                int data_type_cfg, double acc) {
+                                int data_type_cfg, double acc,
+                                double abs_acc) {
   auto dims = desc.dims;
   MD4(float, aout, out, dims.n, dims.oh, dims.ow, dims.oc);
   MD4(float, aref, ref, dims.n, dims.oh, dims.ow, dims.oc);
@@ -599,6 +664,8 @@ int __compare_conv_results_nhwc(eld_conv_t &desc, float *out, float *ref,
         iter_each(_w, dims.ow) {
           auto real = md4(aout, _n, _h, _w, _c);
           double delta = fabs(real - md4(aref, _n, _h, _w, _c));
+          if (delta <= abs_acc)
+            continue;
           if (real == 0 || md4(aref, _n, _h, _w, _c) == 0) {
             if (delta > acc) {
               if (errors < MAX_PRINT_ERRORS) {
@@ -866,6 +933,155 @@ int ref_conv_deconv_2d(eld_conv_t &desc, OutputType *output, InputType *input,
   }
 }
 
+// exp clamped to the normal float range, as the kernels compute it
+static inline double ref_exp(double x) {
+  return exp(std::min(std::max(x, -87.3), 88.3));
+}
+
+static inline double ref_sigmoid(double x) {
+  return 1.0 / (1.0 + ref_exp(-x));
+}
+
+int ref_post_ops(eld_conv_t &desc, float *output, float *prior,
+                 const std::vector<eld_post_op_t> &ops) {
+  int n = desc.dims.n;
+  int oc = desc.dims.oc;
+  int oh = desc.dims.oh;
+  int ow = desc.dims.ow;
+
+  float *toutput = nullptr, *tprior = nullptr;
+  if (desc.formats.output != nchw) {
+    toutput = (float *)malloc(desc.byte_sizes.output);
+    tprior = (float *)malloc(desc.byte_sizes.output);
+    if (desc.formats.output == nChw16c) {
+      reorder<float, nchw, nChw16c>(toutput, output, n, oc, oh, ow);
+      reorder<float, nchw, nChw16c>(tprior, prior, n, oc, oh, ow);
+    } else {
+      reorder<float, nchw, nhwc>(toutput, output, n, oc, oh, ow);
+      reorder<float, nchw, nhwc>(tprior, prior, n, oc, oh, ow);
+    }
+  }
+
+  estl::parallel_for<3>([&](int _n, int _oc, int _oh) {
+    MD4(float, aoutput, desc.formats.output == nchw ? output : toutput,
+        n, oc, oh, ow);
+    MD4(float, aprior, desc.formats.output == nchw ? prior : tprior,
+        n, oc, oh, ow);
+    iter_each(_ow, ow) {
+      double x = md4(aoutput, _n, _oc, _oh, _ow);
+      for (auto &op : ops) {
+        switch (op.kind) {
+        case POST_OP_SUM:
+          x += op.alpha * md4(aprior, _n, _oc, _oh, _ow);
+          break;
+        case POST_OP_RELU:
+          x = x > 0.0 ? x : 0.0;
+          break;
+        case POST_OP_LEAKY_RELU:
+          x = x > 0.0 ? x : op.alpha * x;
+          break;
+        case POST_OP_ELU:
+          x = x > 0.0 ? x : op.alpha * (ref_exp(x) - 1.0);
+          break;
+        case POST_OP_SWISH:
+          x = x * ref_sigmoid(op.alpha * x);
+          break;
+        case POST_OP_GELU: {
+          // 0.5x(1 + tanh(u)) = x * sigmoid(2u), without cancellation
+          double u = 0.7978845608 * (x + 0.044715 * x * x * x);
+          x = x * ref_sigmoid(2.0 * u);
+          break;
+        }
+        case POST_OP_CLIP:
+          x = std::min(std::max(x, (double)op.alpha), (double)op.beta);
+          break;
+        case POST_OP_SCALE_SHIFT:
+          x = x * (op.scale != nullptr ? op.scale[_oc] : 1.0f)
+              + (op.shift != nullptr ? op.shift[_oc] : 0.0f);
+          break;
+        default: // bias by the convolution
+          break;
+        }
+      }
+      md4(aoutput, _n, _oc, _oh, _ow) = x;
+    }
+  }, n, oc, oh);
+
+  if (desc.formats.output == nChw16c) {
+    reorder<float, nChw16c, nchw>(output, toutput, n, oc, oh, ow);
+  } else if (desc.formats.output == nhwc) {
+    reorder<float, nhwc, nchw>(output, toutput, n, oc, oh, ow);
+  }
+
+  if (toutput != nullptr)
+    free(toutput);
+  if (tprior != nullptr)
+    free(tprior);
+
+  return 0;
+}
+
+int ref_pool(eld_conv_t &desc, float *pooled, float *output,
+             const eld_post_op_t &pool) {
+  int n = desc.dims.n;
+  int oc = desc.dims.oc;
+  int oh = desc.dims.oh;
+  int ow = desc.dims.ow;
+  auto &p = pool.pool;
+  int ph = (oh + 2 * p.t - p.kh) / p.sh + 1;
+  int pw = (ow + 2 * p.l - p.kw) / p.sw + 1;
+
+  float *toutput = nullptr, *tpooled = nullptr;
+  if (desc.formats.output != nchw) {
+    toutput = (float *)malloc(desc.byte_sizes.output);
+    tpooled = (float *)malloc(desc.byte_sizes.output);
+    if (desc.formats.output == nChw16c)
+      reorder<float, nchw, nChw16c>(toutput, output, n, oc, oh, ow);
+    else
+      reorder<float, nchw, nhwc>(toutput, output, n, oc, oh, ow);
+  }
+
+  estl::parallel_for<3>([&](int _n, int _oc, int _ph) {
+    MD4(float, aoutput, desc.formats.output == nchw ? output : toutput,
+        n, oc, oh, ow);
+    MD4(float, apooled, desc.formats.output == nchw ? pooled : tpooled,
+        n, oc, ph, pw);
+    iter_each(_pw, pw) {
+      double max = -FLT_MAX, sum = 0.0;
+      int count = 0;
+      iter_each(_kh, p.kh) {
+        int _oh = _ph * p.sh - p.t + _kh;
+        if (_oh < 0 || _oh >= oh)
+          continue;
+        iter_each(_kw, p.kw) {
+          int _ow = _pw * p.sw - p.l + _kw;
+          if (_ow < 0 || _ow >= ow)
+            continue;
+          double x = md4(aoutput, _n, _oc, _oh, _ow);
+          max = std::max(max, x);
+          sum += x;
+          ++count;
+        }
+      }
+      md4(apooled, _n, _oc, _ph, _pw) =
+          pool.kind == POST_OP_MAX_POOL ? max : sum / count;
+    }
+  }, n, oc, ph);
+
+  if (desc.formats.output == nChw16c) {
+    reorder<float, nChw16c, nchw>(pooled, tpooled, n, oc, ph, pw);
+  } else if (desc.formats.output == nhwc) {
+    reorder<float, nhwc, nchw>(pooled, tpooled, n, oc, ph, pw);
+  }
+
+  if (toutput != nullptr)
+    free(toutput);
+  if (tpooled != nullptr)
+    free(tpooled);
+
+  return 0;
+}
+
 void post_process_conv_results(float *output_ref, eld_conv_t &desc,
                                void *output_res, int data_type_cfg) {
   if (data_type_cfg == euler::test::FP32 ||
@@ -88,16 +88,21 @@ namespace test {
       int data_type_cfg = 0, bool f16c_opt = false, bool validate_results = false);
 
   int __compare_conv_results_nchw(eld_conv_t &, float *out,
-      float *ref, int data_type_cfg, double acc);
+      float *ref, int data_type_cfg, double acc, double abs_acc = 0.0);
 
   int __compare_conv_results_nhwc(eld_conv_t &, float *out,
-      float *ref, int data_type_cfg, double acc);
+      float *ref, int data_type_cfg, double acc, double abs_acc = 0.0);
 
   int __compare_conv_results_blocked(eld_conv_t &, float *out,
-      float *ref, int data_type_cfg, double acc);
+      float *ref, int data_type_cfg, double acc, double abs_acc = 0.0);
 
   int compare_conv_results(eld_conv_t &, float *out, float *ref,
-      int data_type_cfg, bool is_int8_lp = false, bool with_real_data = false);
+      int data_type_cfg, bool is_int8_lp = false, bool with_real_data = false,
+      bool abs_bound = false);
+
+  double wino_error_bound(eld_conv_t &, int data_type_cfg);
+
+  double max_abs_conv_output(eld_conv_t &, float *ref);
 
   void post_process_conv_results(float *ouput_ref, eld_conv_t &desc,
       void *output_res, int data_type_cfg);
@@ -109,6 +114,16 @@ namespace test {
   int ref_conv_deconv_2d(eld_conv_t &desc,
       OutputType *output, InputType *input, WeightsType *weights, BiasType *bias);
 
+  // Post-op list ops over output of ref_conv_deconv_2d() run without sum
+  // and relu, in desc output format. prior: output before the convolution
+  int ref_post_ops(eld_conv_t &desc, float *output, float *prior,
+      const std::vector<eld_post_op_t> &ops);
+
+  // Pooling post-op over output of ref_post_ops() to pooled, in desc
+  // output format
+  int ref_pool(eld_conv_t &desc, float *pooled, float *output,
+      const eld_post_op_t &pool);
+
   template <typename InputType, typename WeightsType, typename OutputType, typename BiasType>
   int ref_convolution2d(eld_conv_t &desc,
       OutputType *output, InputType *input, WeightsType *weights, BiasType *bias);
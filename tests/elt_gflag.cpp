@@ -28,6 +28,8 @@ DEFINE_bool(output_as_input, false,
 DEFINE_string(alg, "wino",
               "deconv|auto|wino|direct|direct_1x1. Algorithm. Default: wino");
 DEFINE_int32(tile_size, 0, "Winograd tile size: 0");
+DEFINE_double(wino_error_budget, 0.0,
+              "Winograd tile size by calibrated error budget, 0: off");
 DEFINE_int32(nthreads, 0, "Number of threads per team");
 DEFINE_string(execution_mode, "0x0", "Execution mode");
 DEFINE_int32(flt_o, 1, "OC flatting");
@@ -67,4 +69,34 @@ DEFINE_string(weights_data_file, "", "Weights data file(oihw)");
 DEFINE_string(bias_data_file, "", "Bias data file");
 DEFINE_string(name, "ioi", "Name of layer");
 DEFINE_bool(disable_autoparam, true, "Disable autoparam");
+DEFINE_bool(auto_tune, false,
+            "on|off. Auto-tune execution-mode/flatting/blocking/partition,"
+            " Default: off");
+DEFINE_int32(stream_producers, 0,
+             "Submit from this many threads concurrently to non-eager"
+             " streams and wait, 0 for eager execution. Default: 0");
+DEFINE_bool(arena, false,
+            "on|off. Plan one scratch/workspace arena for repeated layers,"
+            " Default: off");
+DEFINE_int32(arena_inflight, 1,
+             "Layers executing at once on the arena scratch. Default: 1");
+DEFINE_string(post_ops, "",
+              "Post-ops after bias/sum/relu, kind[:alpha[:beta]],...: "
+              "relu|leaky|elu|swish|gelu|clip|scale_shift. Default: none");
+DEFINE_double(sum_alpha, 1.0, "Scale of the inplace sum. Default: 1");
+DEFINE_bool(with_bn, false,
+            "on|off. Batch norm folded into weights and bias, Default: off");
+DEFINE_string(pool, "",
+              "Pooling post-op max|avg:k[:s[:p]], window k x k, strides s,"
+              " pads p. Default: none");
+DEFINE_string(chain, "",
+              "Conv chain by elx_conv_chain against layer by layer elx_conv:"
+              " 1x1 for 1x1 -> conv -> 1x1, dw for depthwise 3x3 -> conv"
+              " (U8F32U8F32)."
+              " Default: none");
+DEFINE_int32(band_rows, 0,
+             "Output rows per band of the conv chain, 0 for auto. Default: 0");
+DEFINE_int32(thread_bands, 0,
+             "Thread bands of the conv chain, 1 on, -1 off, 0 for auto."
+             " Default: 0");
 
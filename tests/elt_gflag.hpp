@@ -33,6 +33,7 @@ DECLARE_bool(dbuffering);
 DECLARE_bool(output_as_input);
 DECLARE_string(alg);
 DECLARE_int32(tile_size);
+DECLARE_double(wino_error_budget);
 DECLARE_int32(nthreads);
 DECLARE_string(execution_mode);
 DECLARE_int32(flt_o);
@@ -61,3 +62,14 @@ DECLARE_string(weights_data_file);
 DECLARE_string(bias_data_file);
 DECLARE_string(name);
 DECLARE_bool(disable_autoparam);
+DECLARE_bool(auto_tune);
+DECLARE_int32(stream_producers);
+DECLARE_bool(arena);
+DECLARE_int32(arena_inflight);
+DECLARE_string(post_ops);
+DECLARE_double(sum_alpha);
+DECLARE_bool(with_bn);
+DECLARE_string(pool);
+DECLARE_string(chain);
+DECLARE_int32(band_rows);
+DECLARE_int32(thread_bands);